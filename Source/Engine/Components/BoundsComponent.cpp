@@ -0,0 +1,27 @@
+#include "BoundsComponent.h"
+#include "GameObject.h"
+#include "Transform.h"
+
+BoundsComponent::BoundsComponent(GameObject* owner, const MeshBounds& localBounds) : IComponent(owner),
+	m_localBounds(localBounds)
+{
+	m_transform = owner->GetTransform();
+}
+
+void BoundsComponent::SetLocalBounds(const MeshBounds& localBounds)
+{
+	m_localBounds = localBounds;
+	m_dirty = true;
+}
+
+const MeshBounds& BoundsComponent::GetWorldBounds() const
+{
+	if (m_dirty || m_transform->GetVersion() != m_cachedTransformVersion)
+	{
+		m_worldBounds = Bounds::Transform(m_localBounds, m_transform->GetWorldMatrix());
+		m_cachedTransformVersion = m_transform->GetVersion();
+		m_dirty = false;
+	}
+
+	return m_worldBounds;
+}
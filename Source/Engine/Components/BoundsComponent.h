@@ -0,0 +1,47 @@
+#pragma once
+#include "IComponent.h"
+#include "Math/Bounds.h"
+#include <cstdint>
+
+class GameObject; // Forward declaration
+class Transform;
+class MeshBVH;
+
+/*
+ * [BoundsComponent]
+ * 메쉬의 로컬 바운딩 볼륨(임포트 시 계산된 값)을 들고,
+ * 소유자 Transform의 월드 행렬로 변환한 월드 바운딩 볼륨을 캐시합니다.
+ * Transform 버전이 바뀐 경우에만 다시 변환합니다.
+ */
+class BoundsComponent : public IComponent
+{
+public:
+	BoundsComponent(GameObject* owner, const MeshBounds& localBounds = {});
+	virtual ~BoundsComponent() = default;
+
+	void SetLocalBounds(const MeshBounds& localBounds);
+	const MeshBounds& GetLocalBounds() const { return m_localBounds; }
+
+	// 컬링 등에서 사용하는 월드 공간 바운딩 볼륨
+	const MeshBounds& GetWorldBounds() const;
+
+	// 레이 질의를 삼각형 단위로 정밀하게 할 때 쓰는 메쉬 BVH (소유하지 않음, 메쉬끼리 공유)
+	void SetMeshBVH(const MeshBVH* meshBVH) { m_meshBVH = meshBVH; }
+	const MeshBVH* GetMeshBVH() const { return m_meshBVH; }
+
+private:
+	// Scene이 공간 인덱스(DynamicBVH) 프록시를 관리합니다.
+	friend class Scene;
+
+	Transform* m_transform = nullptr; // 소유자의 Transform (GameObject 멤버이므로 수명이 같음)
+
+	MeshBounds m_localBounds;
+	const MeshBVH* m_meshBVH = nullptr;
+	mutable MeshBounds m_worldBounds;
+	mutable uint32_t m_cachedTransformVersion = 0;
+	mutable bool m_dirty = true;
+
+	int32_t m_proxyId = -1;                  // Scene::m_SpatialIndex 프록시 (-1 = 아직 등록 안 됨)
+	uint32_t m_indexedTransformVersion = 0;   // 프록시를 마지막으로 갱신한 Transform 버전
+	DirectX::XMFLOAT3 m_indexedCenter = {};   // 이동량(Displacement) 계산용
+};
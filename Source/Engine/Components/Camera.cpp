@@ -2,53 +2,132 @@
 #include "GameObject.h"
 #include "Transform.h"
 
-// ī޶ Ʈ 
+// 카메라 컴포넌트 생성자
 Camera::Camera(GameObject* owner) : IComponent(owner),
 	m_fov(60.0f),
 	m_aspectRatio(16.0f / 9.0f),
 	m_nearPlane(0.1f),
 	m_farPlane(1000.0f)
 {
-	
+	// GetComponent<Transform>() 조회를 매번 하지 않도록 포인터를 기억해 둡니다.
+	m_transform = owner->GetTransform();
 }
 
 void Camera::Init()
 {
-	// ʱ     
-	DirectX::XMStoreFloat4x4(&m_viewMatrix, GetViewMatrix());
-	SetProjectionMatrix(m_fov, m_aspectRatio, m_nearPlane, m_farPlane);
+	// 초기 뷰 및 투영 행렬 설정
+	m_viewDirty = true;
+	m_projectionDirty = true;
+	RefreshViewData();
 }
 
-//   
+// 뷰 행렬 가져오기
 XMMATRIX Camera::GetViewMatrix() const
 {
-	Transform* transform = GetOwner()->GetComponent<Transform>();
-
-	XMFLOAT3 pos = transform->GetPosition();
-	XMFLOAT3 forward = transform->GetForward();
-	XMFLOAT3 up = transform->GetUp();
+	return XMLoadFloat4x4A(&GetViewData().View);
+}
 
-	XMVECTOR posVec = XMLoadFloat3(&pos);
-	XMVECTOR forwardVec = XMLoadFloat3(&forward);
-	XMVECTOR upVec = XMLoadFloat3(&up);
+// 투영 행렬 가져오기
+XMMATRIX Camera::GetProjectionMatrix() const
+{
+	return XMLoadFloat4x4A(&GetViewData().Projection);
+}
 
-	XMVECTOR target = XMVectorAdd(posVec, forwardVec);
-	return XMMatrixLookAtLH(posVec, target, upVec);
+// 뷰 * 투영 행렬 가져오기
+XMMATRIX Camera::GetViewProjectionMatrix() const
+{
+	return XMLoadFloat4x4A(&GetViewData().ViewProjection);
 }
 
-//   
-XMMATRIX Camera::GetProjectionMatrix() const
+const CameraViewData& Camera::GetViewData() const
 {
-	return XMLoadFloat4x4(&m_projectionMatrix);
+	if (m_transform->GetVersion() != m_cachedTransformVersion)
+	{
+		m_viewDirty = true;
+	}
+
+	if (m_viewDirty || m_projectionDirty)
+	{
+		RefreshViewData();
+	}
+
+	return m_viewData;
 }
 
-//   
+// 투영 행렬 설정
 void Camera::SetProjectionMatrix(float fov, float aspectRatio, float nearPlane, float farPlane)
 {
+	// 에디터는 매 프레임 같은 값으로 호출하므로, 바뀌지 않았다면 아무것도 하지 않습니다.
+	if (fov == m_fov && aspectRatio == m_aspectRatio &&
+		nearPlane == m_nearPlane && farPlane == m_farPlane && !m_projectionDirty)
+	{
+		return;
+	}
+
 	m_fov = fov;
 	m_aspectRatio = aspectRatio;
 	m_nearPlane = nearPlane;
 	m_farPlane = farPlane;
-	XMMATRIX projMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(m_fov), m_aspectRatio, m_nearPlane, m_farPlane);
-	XMStoreFloat4x4(&m_projectionMatrix, projMatrix);	
+	m_projectionDirty = true;
+}
+
+// 캐시 재계산 (뷰, 투영, 뷰*투영, 프러스텀 평면)
+void Camera::RefreshViewData() const
+{
+	if (m_viewDirty)
+	{
+		XMFLOAT3 pos = m_transform->GetPosition();
+		XMFLOAT3 forward = m_transform->GetForward();
+		XMFLOAT3 up = m_transform->GetUp();
+
+		XMVECTOR posVec = XMLoadFloat3(&pos);
+		XMVECTOR forwardVec = XMLoadFloat3(&forward);
+		XMVECTOR upVec = XMLoadFloat3(&up);
+
+		XMStoreFloat4x4A(&m_viewData.View, XMMatrixLookToLH(posVec, forwardVec, upVec));
+		m_viewData.Position = XMFLOAT4A(pos.x, pos.y, pos.z, 1.0f);
+
+		m_cachedTransformVersion = m_transform->GetVersion();
+		m_viewDirty = false;
+	}
+
+	if (m_projectionDirty)
+	{
+		XMMATRIX projMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(m_fov), m_aspectRatio, m_nearPlane, m_farPlane);
+		XMStoreFloat4x4A(&m_viewData.Projection, projMatrix);
+		m_projectionDirty = false;
+	}
+
+	XMMATRIX viewProj = XMMatrixMultiply(
+		XMLoadFloat4x4A(&m_viewData.View),
+		XMLoadFloat4x4A(&m_viewData.Projection));
+	XMStoreFloat4x4A(&m_viewData.ViewProjection, viewProj);
+
+	// 프러스텀 평면 추출 (Gribb-Hartmann)
+	// 행 벡터 규약(v * M)이므로 M의 '열'을 조합합니다. D3D의 깊이 범위는 [0, 1]입니다.
+	const XMFLOAT4X4A& m = m_viewData.ViewProjection;
+	const XMFLOAT4 col0 = { m._11, m._21, m._31, m._41 };
+	const XMFLOAT4 col1 = { m._12, m._22, m._32, m._42 };
+	const XMFLOAT4 col2 = { m._13, m._23, m._33, m._43 };
+	const XMFLOAT4 col3 = { m._14, m._24, m._34, m._44 };
+
+	XMVECTOR c0 = XMLoadFloat4(&col0);
+	XMVECTOR c1 = XMLoadFloat4(&col1);
+	XMVECTOR c2 = XMLoadFloat4(&col2);
+	XMVECTOR c3 = XMLoadFloat4(&col3);
+
+	XMVECTOR planes[FRUSTUM_PLANE_COUNT] =
+	{
+		XMVectorAdd(c3, c0),      // Left
+		XMVectorSubtract(c3, c0), // Right
+		XMVectorAdd(c3, c1),      // Bottom
+		XMVectorSubtract(c3, c1), // Top
+		c2,                       // Near
+		XMVectorSubtract(c3, c2), // Far
+	};
+
+	for (uint32_t i = 0; i < FRUSTUM_PLANE_COUNT; ++i)
+	{
+		XMStoreFloat4A(&m_viewData.FrustumPlanes[i], XMPlaneNormalize(planes[i]));
+	}
 }
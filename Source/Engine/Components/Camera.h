@@ -1,10 +1,40 @@
 #pragma once
 #include "IComponent.h"
 #include <DirectXMath.h>
+#include <cstdint>
 
 using namespace DirectX;
 
 class GameObject; // Forward declaration
+class Transform;
+
+// 프러스텀 평면 인덱스
+enum FrustumPlane : uint32_t
+{
+	FRUSTUM_LEFT = 0,
+	FRUSTUM_RIGHT,
+	FRUSTUM_BOTTOM,
+	FRUSTUM_TOP,
+	FRUSTUM_NEAR,
+	FRUSTUM_FAR,
+	FRUSTUM_PLANE_COUNT
+};
+
+/*
+ * [CameraViewData]
+ * 카메라가 캐시하는 뷰 관련 데이터 묶음입니다.
+ * 16바이트 정렬되어 있으므로 XMLoadFloat4A / XMLoadFloat4x4A로 바로 읽을 수 있습니다.
+ * 평면은 (a, b, c, d) 형태로 정규화되어 있으며, 안쪽이 양수입니다.
+ * (dot(n, p) + d >= 0 이면 평면 안쪽)
+ */
+struct alignas(16) CameraViewData
+{
+	XMFLOAT4X4A View;
+	XMFLOAT4X4A Projection;
+	XMFLOAT4X4A ViewProjection;
+	XMFLOAT4A   FrustumPlanes[FRUSTUM_PLANE_COUNT];
+	XMFLOAT4A   Position; // 월드 공간 카메라 위치 (w = 1)
+};
 
 class Camera : public IComponent
 {
@@ -16,17 +46,26 @@ public:
 
 	XMMATRIX GetViewMatrix() const;
 	XMMATRIX GetProjectionMatrix() const;
+	XMMATRIX GetViewProjectionMatrix() const;
+
+	// Transform이나 투영 값이 바뀐 경우에만 다시 계산된 데이터를 반환합니다.
+	const CameraViewData& GetViewData() const;
 
+	// 값이 실제로 바뀔 때만 투영 캐시를 무효화합니다.
 	void SetProjectionMatrix(float fov, float aspectRatio, float nearPlane, float farPlane);
 
 private:
+	void RefreshViewData() const;
 
 	float m_fov = 60.0f;
 	float m_aspectRatio = 16.0f / 9.0f;
 	float m_nearPlane = 0.1f;
 	float m_farPlane = 1000.0f;
 
-	XMFLOAT4X4 m_viewMatrix;
-	XMFLOAT4X4 m_projectionMatrix;
-};
+	Transform* m_transform = nullptr; // 소유자의 Transform (GameObject 멤버이므로 수명이 같음)
 
+	mutable CameraViewData m_viewData = {};
+	mutable uint32_t m_cachedTransformVersion = 0;
+	mutable bool m_viewDirty = true;
+	mutable bool m_projectionDirty = true;
+};
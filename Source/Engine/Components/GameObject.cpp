@@ -1,6 +1,6 @@
 #include "GameObject.h"
 
-GameObject::GameObject(std::string name) : m_name(name), m_transform(this)
+GameObject::GameObject(StringId name) : m_name(name), m_transform(this)
 {
 
 }
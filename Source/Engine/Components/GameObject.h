@@ -3,23 +3,34 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <limits>
 #include "Transform.h"
+#include "Utils/ObjectPool.h"
+#include "Utils/StringId.h"
 
 class IComponent;
 
 class GameObject
 {
 public:
-	GameObject(std::string name = "GameObject");
+	GameObject(StringId name = "GameObject");
 	~GameObject();
 
 	Transform* GetTransform() { return &m_transform; }
+
+	// Name is fixed at creation (Scene indexes objects by name)
+	StringId GetName() const { return m_name; }
+
+	StringId GetTag() const { return m_tag; }
+	void SetTag(StringId tag) { m_tag = tag; }
 	
 	template<typename T, typename ...Args>
 	T* AddComponent(Args&& ...args)
 	{
-		std::unique_ptr<T> newComponent = std::make_unique<T>(this, std::forward<Args>(args)...);
-		T* newComponentPtr = newComponent.get();
+		// Components live in per-type pools (ObjectPool<T>), not individual heap blocks
+		PoolPtr<IComponent> newComponent = MakePooled<T, IComponent>(this, std::forward<Args>(args)...);
+		T* newComponentPtr = static_cast<T*>(newComponent.get());
 		m_components.emplace_back(std::move(newComponent));
 		return newComponentPtr;
 	}
@@ -44,9 +55,20 @@ public:
 
 	void Update(float deltaTime);
 
+	bool IsPendingDestroy() const { return m_pendingDestroy; }
+
 private:
-	std::string m_name;
+	// Scene owns the slot bookkeeping below (O(1) swap-remove on destroy)
+	friend class Scene;
+
+	static constexpr uint32_t INVALID_SCENE_INDEX = std::numeric_limits<uint32_t>::max();
+
+	StringId m_name;	// Interned: 8-byte hash, string lives in the global table
+	StringId m_tag;
 	Transform m_transform;
 
-	std::vector<std::unique_ptr<IComponent>> m_components;
+	std::vector<PoolPtr<IComponent>> m_components;
+
+	uint32_t m_sceneIndex = INVALID_SCENE_INDEX; // Index in Scene::m_GameObjects
+	bool m_pendingDestroy = false;               // Queued in Scene::m_PendingDestroy
 };
\ No newline at end of file
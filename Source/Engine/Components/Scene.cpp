@@ -3,47 +3,307 @@
 #include "GameObject.h"
 #include "IComponent.h"
 #include "Camera.h"
+#include "BoundsComponent.h"
+#include "Core/JobSystem.h"
+#include "Spatial/MeshBVH.h"
+
+#include <algorithm>
 
 void Scene::Update(float deltaTime)
 {
-	for (const auto& gameObject : m_GameObjects)
+	// Index loop: components may create objects while we iterate (vector may grow)
+	for (size_t i = 0; i < m_GameObjects.size(); ++i)
 	{
-		gameObject->Update(deltaTime);
+		m_GameObjects[i]->Update(deltaTime);
 	}
+
+	FlushDestroyedObjects();
+	FlushDirtyTransforms();
+	UpdateSpatialIndex();
 }
 
-GameObject* Scene::CreateGameObject(const std::string& name)
+GameObject* Scene::CreateGameObject(StringId name)
 {
-	auto newObject = std::make_unique<GameObject>(name);
+	PoolPtr<GameObject> newObject = MakePooled<GameObject>(name);
 	GameObject* ptr = newObject.get();
+	ptr->m_sceneIndex = static_cast<uint32_t>(m_GameObjects.size());
 	m_GameObjects.emplace_back(std::move(newObject));
+	m_NameIndex.emplace(name, ptr);
 	
 	return ptr;
 }
 
+GameObject* Scene::FindByName(StringId name) const
+{
+	auto it = m_NameIndex.find(name);
+	return (it != m_NameIndex.end()) ? it->second : nullptr;
+}
+
 GameObject* Scene::DestroyGameObject(GameObject* object)
 {
-	Camera* camera = object->GetComponent<Camera>();
-	if (camera && camera == m_MainCamera)
+	if (!object || object->m_pendingDestroy)
 	{
-		m_MainCamera = nullptr;
+		return nullptr;
 	}
 
-	// Erase Remove Idiom
-	auto it = std::remove_if(m_GameObjects.begin(), m_GameObjects.end(),
-		[object](const std::unique_ptr<GameObject>& objPtr)
+	// Reject objects that don't belong to this scene
+	const uint32_t index = object->m_sceneIndex;
+	if (index >= m_GameObjects.size() || m_GameObjects[index].get() != object)
+	{
+		return nullptr;
+	}
+
+	object->m_pendingDestroy = true;
+	m_PendingDestroy.push_back(object);
+
+	return object;
+}
+
+void Scene::FlushDestroyedObjects()
+{
+	if (m_PendingDestroy.empty()) return;
+
+	++m_DestroyGeneration;
+
+	for (GameObject* object : m_PendingDestroy)
+	{
+		if (m_MainCamera && m_MainCamera->GetOwner() == object)
+		{
+			m_MainCamera = nullptr;
+		}
+
+		BoundsComponent* bounds = object->GetComponent<BoundsComponent>();
+		if (bounds && bounds->m_proxyId != DynamicBVH::NULL_NODE)
+		{
+			m_SpatialIndex.DestroyProxy(bounds->m_proxyId);
+			bounds->m_proxyId = DynamicBVH::NULL_NODE;
+		}
+
+		auto range = m_NameIndex.equal_range(object->m_name);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == object)
+			{
+				m_NameIndex.erase(it);
+				break;
+			}
+		}
+
+		// Swap-and-pop: move the last object into the freed slot and fix its index
+		const uint32_t index = object->m_sceneIndex;
+		const uint32_t lastIndex = static_cast<uint32_t>(m_GameObjects.size() - 1);
+
+		if (index != lastIndex)
 		{
-			return objPtr.get() == object;
+			std::swap(m_GameObjects[index], m_GameObjects[lastIndex]);
+			m_GameObjects[index]->m_sceneIndex = index;
 		}
-	);
 
-	if (it != m_GameObjects.end())
+		m_GameObjects.pop_back(); // Frees the object
+	}
+
+	m_PendingDestroy.clear();
+}
+
+void Scene::FlushDirtyTransforms()
+{
+	for (const auto& gameObject : m_GameObjects)
+	{
+		gameObject->GetTransform()->FlushDirty();
+	}
+}
+
+void Scene::UpdateSpatialIndex()
+{
+	for (const auto& gameObject : m_GameObjects)
 	{
-		m_GameObjects.erase(it, m_GameObjects.end());
-		return object;
+		BoundsComponent* bounds = gameObject->GetComponent<BoundsComponent>();
+		if (!bounds) continue;
+
+		const uint32_t version = gameObject->GetTransform()->GetVersion();
+
+		if (bounds->m_proxyId == DynamicBVH::NULL_NODE)
+		{
+			const Aabb& box = bounds->GetWorldBounds().Box;
+			bounds->m_proxyId = m_SpatialIndex.CreateProxy(box, gameObject.get());
+			bounds->m_indexedTransformVersion = version;
+			bounds->m_indexedCenter = box.Center;
+		}
+		else if (bounds->m_dirty || version != bounds->m_indexedTransformVersion)
+		{
+			// Unchanged transforms cost one version compare; moved ones usually stay inside the fat AABB
+			const Aabb& box = bounds->GetWorldBounds().Box;
+			const DirectX::XMFLOAT3 displacement = {
+				box.Center.x - bounds->m_indexedCenter.x,
+				box.Center.y - bounds->m_indexedCenter.y,
+				box.Center.z - bounds->m_indexedCenter.z };
+
+			m_SpatialIndex.MoveProxy(bounds->m_proxyId, box, displacement);
+			bounds->m_indexedTransformVersion = version;
+			bounds->m_indexedCenter = box.Center;
+		}
 	}
 }
 
+GameObject* Scene::Raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction,
+	float maxDistance, float* outDistance) const
+{
+	RaycastHit hit;
+	RaycastSingle({ origin, direction, maxDistance }, hit);
+
+	if (outDistance) *outDistance = hit.Object ? hit.Distance : maxDistance;
+	return hit.Object;
+}
+
+void Scene::RaycastBatch(const Ray* rays, size_t count, RaycastHit* outHits, JobSystem* jobs)
+{
+	constexpr size_t RAYS_PER_JOB = 64; // Multiple of 4, so chunks never split a packet
+
+	// Bring every lazy cache up to date here, so the workers below never write shared state
+	FlushDirtyTransforms();
+	UpdateSpatialIndex();
+
+	auto castRange = [&](size_t begin, size_t end)
+	{
+		for (size_t first = begin; first < end; first += 4)
+		{
+			const uint32_t laneCount = static_cast<uint32_t>((std::min)(end - first, size_t(4)));
+			const Ray* packetRays = rays + first;
+			RaycastHit* packetHits = outHits + first;
+
+			if (laneCount == 1 || !RayPacket4::IsCoherent(packetRays, laneCount))
+			{
+				for (uint32_t lane = 0; lane < laneCount; ++lane)
+				{
+					RaycastSingle(packetRays[lane], packetHits[lane]);
+				}
+				continue;
+			}
+
+			for (uint32_t lane = 0; lane < laneCount; ++lane)
+			{
+				packetHits[lane] = {};
+			}
+
+			RayPacket4 packet;
+			packet.Load(packetRays, laneCount);
+
+			m_SpatialIndex.RayCastPacket(packet, [&](int32_t proxyId, uint32_t laneMask)
+			{
+				GameObject* object = static_cast<GameObject*>(m_SpatialIndex.GetUserData(proxyId));
+
+				for (uint32_t lane = 0; lane < laneCount; ++lane)
+				{
+					if (!(laneMask & (1u << lane))) continue;
+
+					const Ray& ray = packetRays[lane];
+					uint32_t triangle = RaycastHit::NO_TRIANGLE;
+					const float distance = IntersectObject(object, ray.Origin, ray.Direction, packet.MaxDistance[lane], triangle);
+					if (distance < 0.0f) continue;
+
+					packet.MaxDistance[lane] = distance; // Clip the lane so farther subtrees are skipped
+					packetHits[lane] = { object, distance, triangle };
+				}
+			});
+		}
+	};
+
+	if (jobs) jobs->ParallelFor(count, RAYS_PER_JOB, castRange);
+	else castRange(0, count);
+}
+
+void Scene::RaycastSingle(const Ray& ray, RaycastHit& outHit) const
+{
+	outHit = {};
+
+	m_SpatialIndex.RayCast(ray.Origin, ray.Direction, ray.MaxDistance, [&](int32_t proxyId, float currentMax)
+	{
+		GameObject* object = static_cast<GameObject*>(m_SpatialIndex.GetUserData(proxyId));
+
+		uint32_t triangle = RaycastHit::NO_TRIANGLE;
+		const float distance = IntersectObject(object, ray.Origin, ray.Direction, currentMax, triangle);
+		if (distance < 0.0f) return currentMax; // Missed: keep the ray as is
+
+		outHit = { object, distance, triangle };
+		return distance; // Clip the ray so farther subtrees are skipped
+	});
+}
+
+float Scene::IntersectObject(GameObject* object, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction,
+	float maxDistance, uint32_t& outTriangle) const
+{
+	// The tree stores fat AABBs, so re-test the object's tight world AABB first
+	const BoundsComponent* bounds = object->GetComponent<BoundsComponent>();
+	const Aabb& box = bounds->GetWorldBounds().Box;
+
+	const float o[3] = { origin.x, origin.y, origin.z };
+	const float d[3] = { direction.x, direction.y, direction.z };
+	const float c[3] = { box.Center.x, box.Center.y, box.Center.z };
+	const float e[3] = { box.Extents.x, box.Extents.y, box.Extents.z };
+
+	float tMin = 0.0f;
+	float tMax = maxDistance;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const float inv = 1.0f / d[axis];
+		float t1 = (c[axis] - e[axis] - o[axis]) * inv;
+		float t2 = (c[axis] + e[axis] - o[axis]) * inv;
+		if (t1 > t2) std::swap(t1, t2);
+		tMin = (std::max)(tMin, t1);
+		tMax = (std::min)(tMax, t2);
+	}
+
+	if (tMin > tMax) return -1.0f;
+
+	const MeshBVH* meshBVH = bounds->GetMeshBVH();
+	if (!meshBVH)
+	{
+		outTriangle = RaycastHit::NO_TRIANGLE;
+		return tMin;
+	}
+
+	// Move the ray into mesh space. The transform is affine, so the ray parameter
+	// (and with it the distance) is the same in both spaces.
+	using namespace DirectX;
+	XMVECTOR determinant;
+	const XMMATRIX worldToLocal = XMMatrixInverse(&determinant,
+		XMLoadFloat4x4(&object->GetTransform()->GetWorldMatrix4x4()));
+	if (XMVectorGetX(determinant) == 0.0f) return -1.0f; // Zero scale: nothing to hit
+
+	XMFLOAT3 localOrigin, localDirection;
+	XMStoreFloat3(&localOrigin, XMVector3TransformCoord(XMLoadFloat3(&origin), worldToLocal));
+	XMStoreFloat3(&localDirection, XMVector3TransformNormal(XMLoadFloat3(&direction), worldToLocal));
+
+	MeshBVH::Hit hit;
+	if (!meshBVH->RayCast(localOrigin, localDirection, maxDistance, hit)) return -1.0f;
+
+	outTriangle = hit.TriangleIndex;
+	return hit.Distance;
+}
+
+void Scene::QueryRadius(const DirectX::XMFLOAT3& center, float radius, std::vector<GameObject*>& out) const
+{
+	BoundingSphere query;
+	query.Center = center;
+	query.Radius = radius;
+
+	m_SpatialIndex.QuerySphere(query, [&](int32_t proxyId)
+	{
+		GameObject* object = static_cast<GameObject*>(m_SpatialIndex.GetUserData(proxyId));
+		const BoundingSphere& sphere = object->GetComponent<BoundsComponent>()->GetWorldBounds().Sphere;
+
+		const float dx = sphere.Center.x - center.x;
+		const float dy = sphere.Center.y - center.y;
+		const float dz = sphere.Center.z - center.z;
+		const float reach = sphere.Radius + radius;
+		if (dx * dx + dy * dy + dz * dz <= reach * reach)
+		{
+			out.push_back(object);
+		}
+		return true;
+	});
+}
+
 void Scene::SetMainCamera(Camera* camera)
 {
 	m_MainCamera = camera;
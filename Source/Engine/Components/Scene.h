@@ -3,9 +3,27 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
+
+#include <DirectXMath.h>
+
+#include "Spatial/DynamicBVH.h"
+#include "Spatial/RayPacket.h"
+#include "Utils/ObjectPool.h"
+#include "Utils/StringId.h"
 
 class GameObject; // Forward declaration
 class Camera;
+class JobSystem;
+
+struct RaycastHit
+{
+	static constexpr uint32_t NO_TRIANGLE = UINT32_MAX;
+
+	GameObject* Object = nullptr;         // nullptr if the ray hit nothing
+	float Distance = 0.0f;                // In units of the ray direction's length
+	uint32_t TriangleIndex = NO_TRIANGLE; // Triangle in the object's MeshBVH, if it has one
+};
 
 class Scene
 {
@@ -15,18 +33,72 @@ public:
 
 	void Update(float deltaTime);
 
-	GameObject* CreateGameObject(const std::string& name = "GameObject");
+	GameObject* CreateGameObject(StringId name = "GameObject");
+
+	// O(1) name lookup. Returns an object with that name, or nullptr.
+	// Names may repeat; which of the duplicates is returned is unspecified.
+	GameObject* FindByName(StringId name) const;
+
+	// Queues the object for destruction. The object stays alive (and in
+	// GetGameObjects()) until FlushDestroyedObjects() runs at the end of Update.
+	// Returns the object if it was queued, nullptr if it was already queued or not ours.
 	GameObject* DestroyGameObject(GameObject* object);
 
+	// Frees every queued object with a swap-remove. O(K) for K queued objects.
+	void FlushDestroyedObjects();
+
+	// Bumped whenever FlushDestroyedObjects frees something. Pool slots are reused,
+	// so caches keyed by GameObject* compare this to drop stale entries.
+	uint32_t GetDestroyGeneration() const { return m_DestroyGeneration; }
+
+	// Rebuilds cached world matrices of every dirty Transform once per frame,
+	// so the editor and game views only read cached matrices while rendering.
+	void FlushDirtyTransforms();
+
+	// Keeps one DynamicBVH proxy per object with a BoundsComponent.
+	// Proxies are created on first sight and only re-inserted when the world
+	// bounds leave their fattened AABB.
+	void UpdateSpatialIndex();
+
+	// Shared by culling, editor picking and gameplay proximity queries.
+	// Proxy user data is the owning GameObject*.
+	const DynamicBVH& GetSpatialIndex() const { return m_SpatialIndex; }
+
+	// Nearest object whose world AABB the ray hits, or nullptr. direction need not be normalized,
+	// distances are in units of its length.
+	GameObject* Raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction,
+		float maxDistance, float* outDistance = nullptr) const;
+
+	// Casts count rays and writes one hit per ray. Groups of four rays with matching
+	// direction signs walk the tree together as an SSE packet; other groups fall back
+	// to single-ray traversal. With jobs, groups are spread over the worker threads.
+	// Objects with a MeshBVH are hit per triangle, others by their world AABB.
+	// Workers must only read cached state: GetWorldBounds() and GetWorldMatrix4x4() write their
+	// caches when dirty. So this first flushes dirty transforms and refreshes the spatial index
+	// on the calling thread, and nothing may move objects until it returns.
+	void RaycastBatch(const Ray* rays, size_t count, RaycastHit* outHits, JobSystem* jobs = nullptr);
+
+	// Objects whose world bounding sphere overlaps the given sphere (appended to out).
+	void QueryRadius(const DirectX::XMFLOAT3& center, float radius, std::vector<GameObject*>& out) const;
+
 	void SetMainCamera(Camera* camera);
 	Camera* GetMainCamera() const;
 
-	const std::vector<std::unique_ptr<GameObject>>& GetGameObjects() 
+	const std::vector<PoolPtr<GameObject>>& GetGameObjects() 
 		const { return m_GameObjects; }
 private:
+	// Exact hit distance in [0, maxDistance] against one object, or a negative value on a miss.
+	float IntersectObject(GameObject* object, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction,
+		float maxDistance, uint32_t& outTriangle) const;
+
+	void RaycastSingle(const Ray& ray, RaycastHit& outHit) const;
 
 	std::string m_Name;
-	std::vector<std::unique_ptr<GameObject>> m_GameObjects;
+	std::vector<PoolPtr<GameObject>> m_GameObjects; // Backed by ObjectPool<GameObject>
+	std::vector<GameObject*> m_PendingDestroy;
+	std::unordered_multimap<StringId, GameObject*> m_NameIndex; // Names may repeat
+	DynamicBVH m_SpatialIndex;
+	uint32_t m_DestroyGeneration = 0;
 	
 	Camera* m_MainCamera = nullptr;
 };
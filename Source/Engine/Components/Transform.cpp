@@ -1,6 +1,6 @@
 #include "Transform.h"
 
-// ġ deltaŭ ̵Ű Լ
+// 위치를 delta만큼 이동시키는 함수
 void Transform::Translate(const XMFLOAT3& delta)
 {
 	XMVECTOR currentPos = XMLoadFloat3(&m_position);
@@ -8,9 +8,10 @@ void Transform::Translate(const XMFLOAT3& delta)
 	XMVECTOR newPos = XMVectorAdd(currentPos, deltaVec);
 	
 	XMStoreFloat3(&m_position, newPos);
+	MarkDirty();
 }
 
-// ȸ ʹϾ ϴ Լ
+// 회전을 쿼터니언으로 적용하는 함수
 void Transform::Rotate(const XMFLOAT4& quaterinion)
 {
 	XMVECTOR currentRot = XMLoadFloat4(&m_rotation);
@@ -18,60 +19,62 @@ void Transform::Rotate(const XMFLOAT4& quaterinion)
 	XMVECTOR newRot = XMQuaternionMultiply(currentRot, deltaRot);
 	
 	XMStoreFloat4(&m_rotation, newRot);
+	MarkDirty();
 }
 
-//    ȯ
+// 앞 방향 벡터 반환
 XMFLOAT3 Transform::GetForward() const
 {
-	static const XMVECTOR V_FORWARD = XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
-	XMVECTOR rotationQuat = XMLoadFloat4(&m_rotation);
-
-	XMVECTOR ret = XMVector3Rotate(V_FORWARD, rotationQuat);
-
-	XMFLOAT3 forward;
-	XMStoreFloat3(&forward, ret);
-
-    return forward;
+	FlushDirty();
+	return m_forward;
 }
 
-//    ȯ
+// 위 방향 벡터 반환
 XMFLOAT3 Transform::GetUp() const
 {
-	static const XMVECTOR V_UP = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
-	XMVECTOR rotationQuat = XMLoadFloat4(&m_rotation);
-
-	XMVECTOR ret = XMVector3Rotate(V_UP, rotationQuat);
-	
-	XMFLOAT3 up;
-	XMStoreFloat3(&up, ret);
-    
-	return up;
+	FlushDirty();
+	return m_up;
 }
 
-//    ȯ
+// 오른쪽 방향 벡터 반환
 XMFLOAT3 Transform::GetRight() const
 {
-	static const XMVECTOR V_RIGHT = { 1.0f, 0.0f, 0.0f, 0.0f };
-	XMVECTOR rotationQuat = XMLoadFloat4(&m_rotation);
-
-	XMVECTOR ret = XMVector3Rotate(V_RIGHT, rotationQuat);
+	FlushDirty();
+	return m_right;
+}
 
-	XMFLOAT3 right;
-	XMStoreFloat3(&right, ret);
+// 월드 변환 행렬 반환
+XMMATRIX Transform::GetWorldMatrix() const
+{
+	FlushDirty();
+	return XMLoadFloat4x4(&m_worldMatrix);
+}
 
-	return right;
+const XMFLOAT4X4& Transform::GetWorldMatrix4x4() const
+{
+	FlushDirty();
+	return m_worldMatrix;
 }
 
-//  ȯ  ȯ
-XMMATRIX Transform::GetWorldMatrix() const
+// 캐시 재계산
+// S * R * T를 행렬 곱 세 번으로 만드는 대신,
+// 회전 행렬의 각 행에 스케일을 곱하고 마지막 행에 위치를 넣어 한 번에 만듭니다.
+// 회전 행렬의 행 0/1/2가 곧 Right/Up/Forward 기저 벡터입니다.
+void Transform::UpdateCache() const
 {
-	XMVECTOR scaleVec = XMLoadFloat3(&m_scale);
 	XMVECTOR rotationQuat = XMLoadFloat4(&m_rotation);
-	XMVECTOR positionVec = XMLoadFloat3(&m_position);
-
-	XMMATRIX scaleMatrix = XMMatrixScalingFromVector(scaleVec);
 	XMMATRIX rotationMatrix = XMMatrixRotationQuaternion(rotationQuat);
-	XMMATRIX translationMatrix = XMMatrixTranslationFromVector(positionVec);
 
-	return scaleMatrix * rotationMatrix * translationMatrix;
+	XMStoreFloat3(&m_right, rotationMatrix.r[0]);
+	XMStoreFloat3(&m_up, rotationMatrix.r[1]);
+	XMStoreFloat3(&m_forward, rotationMatrix.r[2]);
+
+	XMMATRIX world;
+	world.r[0] = XMVectorScale(rotationMatrix.r[0], m_scale.x);
+	world.r[1] = XMVectorScale(rotationMatrix.r[1], m_scale.y);
+	world.r[2] = XMVectorScale(rotationMatrix.r[2], m_scale.z);
+	world.r[3] = XMVectorSetW(XMLoadFloat3(&m_position), 1.0f);
+
+	XMStoreFloat4x4(&m_worldMatrix, world);
+	m_dirty = false;
 }
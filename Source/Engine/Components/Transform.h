@@ -1,6 +1,7 @@
 #pragma once
 
 #include <DirectXMath.h>
+#include <cstdint>
 #include "IComponent.h"
 
 class GameObject;	// Forward declaration
@@ -12,30 +13,53 @@ public:
 	Transform(GameObject* owner) : IComponent(owner) {}
 	virtual ~Transform() = default;
 
-	// ġ   
+	// 위치 설정 및 가져오기
 	XMFLOAT3 GetPosition() const { return m_position; }
-	void SetPosition(const XMFLOAT3& position) { m_position = position; }
-	void SetPosition(float x, float y, float z) { m_position = XMFLOAT3(x, y, z); }
+	void SetPosition(const XMFLOAT3& position) { m_position = position; MarkDirty(); }
+	void SetPosition(float x, float y, float z) { m_position = XMFLOAT3(x, y, z); MarkDirty(); }
 	void Translate(const XMFLOAT3& delta);
 	
-	// ȸ    (ʹϾ)
+	// 회전 설정 및 가져오기 (쿼터니언)
 	XMFLOAT4 GetRotation() const { return m_rotation; }
-	void SetRotation(const XMFLOAT4& quaterinion) { m_rotation = quaterinion; }
-	void SetRotation(float x, float y, float z, float w) { m_rotation = XMFLOAT4(x, y, z, w); }
+	void SetRotation(const XMFLOAT4& quaterinion) { m_rotation = quaterinion; MarkDirty(); }
+	void SetRotation(float x, float y, float z, float w) { m_rotation = XMFLOAT4(x, y, z, w); MarkDirty(); }
 	void Rotate(const XMFLOAT4& quaterinion);
 
-	//    
+	// 스케일 설정 및 가져오기
 	XMFLOAT3 GetScale() const { return m_scale; }
-	void SetScale(const XMFLOAT3& scale) { m_scale = scale; }
+	void SetScale(const XMFLOAT3& scale) { m_scale = scale; MarkDirty(); }
 
+	// 아래 값들은 캐시에서 읽습니다. (dirty일 때만 재계산)
 	XMFLOAT3 GetForward() const;
 	XMFLOAT3 GetUp() const;
 	XMFLOAT3 GetRight() const;
 
 	XMMATRIX GetWorldMatrix() const;
+	const XMFLOAT4X4& GetWorldMatrix4x4() const;
+
+	// 프레임 단위 갱신: dirty이면 캐시를 다시 계산합니다. (Scene::FlushDirtyTransforms)
+	// 이 패스 이후에는 렌더링 중 여러 뷰가 호출해도 재계산이 일어나지 않습니다.
+	bool IsDirty() const { return m_dirty; }
+	void FlushDirty() const { if (m_dirty) UpdateCache(); }
+
+	// 값이 바뀔 때마다 증가합니다. 
+	// 이 Transform에 의존하는 캐시(예: Camera의 뷰 행렬)가 변경 여부를 확인하는 데 씁니다.
+	uint32_t GetVersion() const { return m_version; }
 
 private:
+	void MarkDirty() { m_dirty = true; ++m_version; }
+	void UpdateCache() const;
+
 	XMFLOAT3  m_position = { 0.0f, 0.0f, 0.0f };	   // Translation
 	XMFLOAT4  m_rotation = { 0.0f, 0.0f, 0.0f, 1.0f }; // Quaternion
 	XMFLOAT3  m_scale = { 1.0f, 1.0f, 1.0f };		   // Scale
+
+	// 캐시 (월드 행렬 + 기저 벡터)
+	mutable XMFLOAT4X4 m_worldMatrix = {};
+	mutable XMFLOAT3   m_right = { 1.0f, 0.0f, 0.0f };
+	mutable XMFLOAT3   m_up = { 0.0f, 1.0f, 0.0f };
+	mutable XMFLOAT3   m_forward = { 0.0f, 0.0f, 1.0f };
+	mutable bool       m_dirty = true;
+
+	uint32_t m_version = 0;
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+// BindlessDescriptorHeap.cpp
+#include "Core/BindlessDescriptorHeap.h"
+
+#include "Utils/Utils.h" // ThrowIfFailed
+
+#include <stdexcept>
+
+BindlessDescriptorHeap::BindlessDescriptorHeap(ID3D12Device* device, uint32_t persistentCount, uint32_t transientCountPerFrame, UINT frameCount)
+	: m_persistentCount(persistentCount), m_transientCountPerFrame(transientCountPerFrame)
+{
+	D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+	heapDesc.NumDescriptors = persistentCount + transientCountPerFrame * frameCount;
+	heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+	ThrowIfFailed(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_heap)));
+
+	m_cpuStart = m_heap->GetCPUDescriptorHandleForHeapStart();
+	m_gpuStart = m_heap->GetGPUDescriptorHandleForHeapStart();
+	m_incrementSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	// 뒤에서 꺼내므로 0번이 먼저 나가도록 거꾸로 넣습니다.
+	m_freeIndices.reserve(persistentCount);
+	for (uint32_t index = persistentCount; index > 0; --index)
+	{
+		m_freeIndices.push_back(index - 1);
+	}
+
+	m_transientBase = persistentCount;
+}
+
+void BindlessDescriptorHeap::BeginFrame(UINT frameIndex, UINT64 completedFenceValue)
+{
+	while (!m_retiredIndices.empty() && m_retiredIndices.front().FenceValue <= completedFenceValue)
+	{
+		m_freeIndices.push_back(m_retiredIndices.front().Index);
+		m_retiredIndices.pop_front();
+	}
+
+	m_transientBase = m_persistentCount + frameIndex * m_transientCountPerFrame;
+	m_transientHead.store(0);
+}
+
+void BindlessDescriptorHeap::EndFrame(UINT64 fenceValue)
+{
+	for (uint32_t index : m_pendingFrees)
+	{
+		m_retiredIndices.push_back({ fenceValue, index });
+	}
+	m_pendingFrees.clear();
+}
+
+uint32_t BindlessDescriptorHeap::AllocatePersistent()
+{
+	if (m_freeIndices.empty())
+	{
+		Debug::Print("Bindless Descriptor Heap is Full!");
+		throw std::runtime_error("Bindless Descriptor Heap is Full!");
+	}
+
+	const uint32_t index = m_freeIndices.back();
+	m_freeIndices.pop_back();
+	return index;
+}
+
+void BindlessDescriptorHeap::FreePersistent(uint32_t index)
+{
+	if (index >= m_persistentCount) return;
+
+	m_pendingFrees.push_back(index);
+}
+
+uint32_t BindlessDescriptorHeap::AllocateTransient(uint32_t count)
+{
+	const uint32_t offset = m_transientHead.fetch_add(count);
+	if (offset + count > m_transientCountPerFrame)
+	{
+		throw std::runtime_error("Transient Descriptor Range is Full!");
+	}
+	return m_transientBase + offset;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE BindlessDescriptorHeap::GetCpuHandle(uint32_t index) const
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE handle = m_cpuStart;
+	handle.ptr += static_cast<SIZE_T>(index) * m_incrementSize;
+	return handle;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE BindlessDescriptorHeap::GetGpuHandle(uint32_t index) const
+{
+	D3D12_GPU_DESCRIPTOR_HANDLE handle = m_gpuStart;
+	handle.ptr += static_cast<UINT64>(index) * m_incrementSize;
+	return handle;
+}
+
+uint32_t BindlessDescriptorHeap::GetIndex(D3D12_CPU_DESCRIPTOR_HANDLE handle) const
+{
+	return static_cast<uint32_t>((handle.ptr - m_cpuStart.ptr) / m_incrementSize);
+}
+
+uint32_t BindlessDescriptorHeap::GetIndex(D3D12_GPU_DESCRIPTOR_HANDLE handle) const
+{
+	return static_cast<uint32_t>((handle.ptr - m_gpuStart.ptr) / m_incrementSize);
+}
@@ -0,0 +1,87 @@
+// BindlessDescriptorHeap.h
+#pragma once
+
+#include <windows.h>
+#include <wrl.h>
+#include <d3d12.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+/*
+ * [BindlessDescriptorHeap]
+ * 엔진 전체가 같이 쓰는 셰이더 가시(Shader-Visible) CBV/SRV/UAV 디스크립터 힙 하나입니다.
+ * 모든 커맨드 리스트가 이 힙 하나만 바인딩하므로 SetDescriptorHeaps로 힙을 바꿀 일이 없고,
+ * 셰이더는 여기서 받은 인덱스로 디스크립터에 바로 접근할 수 있습니다. (ResourceDescriptorHeap[index])
+ *
+ *   [영구 구간 persistentCount개][프레임 0 임시 구간][프레임 1 임시 구간]...
+ *
+ * - 영구 구간: 텍스처 SRV처럼 오래 사는 디스크립터. 프리 리스트로 재사용하며,
+ *   Free한 인덱스는 EndFrame(펜스 값)에 묶였다가 GPU가 그 펜스를 지나면 BeginFrame에서 다시 쓸 수 있게 됩니다.
+ * - 임시 구간: 한 프레임만 쓰는 디스크립터. 프레임 인덱스별 구간을 앞에서부터 잘라 주고,
+ *   같은 프레임 인덱스가 다시 돌아오면(= D3D12App이 그 프레임의 펜스를 기다린 뒤) 통째로 되감습니다.
+ *
+ * 영구 할당/해제와 BeginFrame/EndFrame은 메인 스레드 전용입니다.
+ * AllocateTransient는 원자적이므로 씬 기록 워커 스레드에서 불러도 됩니다.
+ */
+class BindlessDescriptorHeap
+{
+public:
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+	BindlessDescriptorHeap(ID3D12Device* device, uint32_t persistentCount, uint32_t transientCountPerFrame, UINT frameCount);
+
+	BindlessDescriptorHeap(const BindlessDescriptorHeap&) = delete;
+	BindlessDescriptorHeap& operator=(const BindlessDescriptorHeap&) = delete;
+
+	// GPU가 completedFenceValue까지 끝냈으므로 그 이하 펜스로 묶인 영구 인덱스를 반납하고,
+	// 이번 프레임 인덱스의 임시 구간을 되감습니다.
+	void BeginFrame(UINT frameIndex, UINT64 completedFenceValue);
+	// 지난 EndFrame 이후 Free된 영구 인덱스를 이 펜스 값에 묶습니다. (큐에 Signal한 직후 호출)
+	void EndFrame(UINT64 fenceValue);
+
+	// 영구 구간이 가득 차면 std::runtime_error를 던집니다.
+	uint32_t AllocatePersistent();
+	// GPU가 아직 읽고 있을 수 있으므로 바로 재사용하지 않습니다.
+	void FreePersistent(uint32_t index);
+
+	// 이번 프레임만 쓰는 연속된 count개의 첫 인덱스. 구간이 모자라면 std::runtime_error를 던집니다.
+	uint32_t AllocateTransient(uint32_t count = 1);
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(uint32_t index) const;
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle(uint32_t index) const;
+	uint32_t GetIndex(D3D12_CPU_DESCRIPTOR_HANDLE handle) const;
+	uint32_t GetIndex(D3D12_GPU_DESCRIPTOR_HANDLE handle) const;
+
+	ID3D12DescriptorHeap* GetHeap() const { return m_heap.Get(); }
+
+	uint32_t GetPersistentCapacity() const { return m_persistentCount; }
+	uint32_t GetPersistentUsedCount() const { return m_persistentCount - static_cast<uint32_t>(m_freeIndices.size()); } // 반납 대기 포함
+	uint32_t GetPendingFreeCount() const { return static_cast<uint32_t>(m_pendingFrees.size() + m_retiredIndices.size()); }
+	uint32_t GetTransientCapacity() const { return m_transientCountPerFrame; }
+	uint32_t GetTransientUsedCount() const { return (std::min)(m_transientHead.load(), m_transientCountPerFrame); }
+
+private:
+	// EndFrame으로 펜스 값에 묶인 영구 인덱스
+	struct RetiredIndex
+	{
+		UINT64 FenceValue;
+		uint32_t Index;
+	};
+
+	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_heap;
+	D3D12_CPU_DESCRIPTOR_HANDLE m_cpuStart = {};
+	D3D12_GPU_DESCRIPTOR_HANDLE m_gpuStart = {};
+	UINT m_incrementSize = 0;
+
+	uint32_t m_persistentCount;
+	uint32_t m_transientCountPerFrame;
+
+	std::vector<uint32_t> m_freeIndices;      // 바로 쓸 수 있는 영구 인덱스 (뒤에서 꺼냄)
+	std::vector<uint32_t> m_pendingFrees;     // 이번 프레임에 Free된 것 (아직 펜스 없음)
+	std::deque<RetiredIndex> m_retiredIndices;
+
+	uint32_t m_transientBase = 0;             // 이번 프레임 임시 구간의 시작 인덱스
+	std::atomic<uint32_t> m_transientHead = 0;
+};
@@ -0,0 +1,63 @@
+// CommandListPool.cpp
+#include "Core/CommandListPool.h"
+
+#include "RHI/D3D12RHI.h" // D3D12RHICommandList
+#include "Utils/Utils.h"  // ThrowIfFailed
+
+CommandListPool::CommandListPool(ID3D12Device* device, UINT frameCount)
+	: m_device(device), m_frameCount(frameCount)
+{
+}
+
+CommandListPool::~CommandListPool() = default;
+
+void CommandListPool::BeginFrame(UINT frameIndex)
+{
+	m_frameIndex = frameIndex;
+	m_acquiredCount = 0;
+}
+
+CommandListPool::Entry& CommandListPool::Acquire()
+{
+	if (m_acquiredCount == m_entries.size())
+	{
+		auto entry = std::make_unique<Entry>();
+		entry->Allocators.resize(m_frameCount);
+		for (UINT i = 0; i < m_frameCount; ++i)
+		{
+			ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&entry->Allocators[i])));
+		}
+
+		// 만들자마자 닫아 두고, 아래에서 다른 리스트와 같은 경로로 Reset합니다.
+		ThrowIfFailed(m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+			entry->Allocators[m_frameIndex].Get(), nullptr, IID_PPV_ARGS(&entry->Native)));
+		ThrowIfFailed(entry->Native->Close());
+
+		entry->RHI = std::make_unique<D3D12RHICommandList>(entry->Native.Get());
+		m_entries.push_back(std::move(entry));
+	}
+
+	Entry& entry = *m_entries[m_acquiredCount++];
+
+	// 이 리스트는 한 프레임에 한 번만 받으므로 할당자도 여기서 한 번만 Reset됩니다.
+	ID3D12CommandAllocator* allocator = entry.Allocators[m_frameIndex].Get();
+	ThrowIfFailed(allocator->Reset());
+	ThrowIfFailed(entry.Native->Reset(allocator, nullptr));
+
+	if (m_descriptorHeap)
+	{
+		entry.Native->SetDescriptorHeaps(1, &m_descriptorHeap);
+	}
+
+	return entry;
+}
+
+void CommandListPool::Finish(std::vector<ID3D12CommandList*>& outLists)
+{
+	for (size_t i = 0; i < m_acquiredCount; ++i)
+	{
+		ID3D12GraphicsCommandList* list = m_entries[i]->Native.Get();
+		ThrowIfFailed(list->Close());
+		outLists.push_back(list);
+	}
+}
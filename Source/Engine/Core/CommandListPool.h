@@ -0,0 +1,63 @@
+// CommandListPool.h
+#pragma once
+
+#include <windows.h>
+#include <wrl.h>
+#include <d3d12.h>
+#include <memory>
+#include <vector>
+
+class RHICommandList;
+
+/*
+ * [CommandListPool]
+ * 한 프레임을 여러 커맨드 리스트로 나눠 기록하기 위한 Direct 커맨드 리스트 풀입니다.
+ * - 리스트마다 진행 중인 프레임 수만큼 커맨드 할당자를 가지고, 이번 프레임 인덱스의 것만 Reset합니다.
+ *   (GPU가 아직 읽고 있을 수 있는 다른 프레임의 할당자는 건드리지 않음)
+ * - Acquire는 메인 스레드에서 제출 순서대로 부르고, 받은 리스트는 워커 스레드가 각자 채워도 됩니다.
+ *   Finish가 받은 순서 그대로 닫아서 ExecuteCommandLists에 넘길 배열에 붙여 줍니다.
+ * - 모자라면 늘어나고 줄지 않으므로, 몇 프레임 지나면 새로 만들지 않습니다.
+ * - SetDescriptorHeap으로 정한 셰이더 가시 힙을 Acquire할 때마다 바인딩해 둡니다.
+ */
+class CommandListPool
+{
+public:
+	// 받은 리스트 하나. Native와 RHI는 같은 리스트입니다.
+	struct Entry
+	{
+		std::vector<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>> Allocators; // 프레임 인덱스별
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> Native;
+		std::unique_ptr<RHICommandList> RHI;
+	};
+
+	CommandListPool(ID3D12Device* device, UINT frameCount);
+	~CommandListPool();
+
+	CommandListPool(const CommandListPool&) = delete;
+	CommandListPool& operator=(const CommandListPool&) = delete;
+
+	// 이번 프레임의 할당자 인덱스를 정하고, 지난 프레임에 받은 리스트를 모두 반납합니다.
+	void BeginFrame(UINT frameIndex);
+
+	// 다음 순서의 리스트를 Reset해서 기록 상태로 돌려줍니다. (메인 스레드 전용)
+	Entry& Acquire();
+
+	// 이번 프레임에 받은 리스트를 받은 순서대로 닫고 outLists 뒤에 붙입니다.
+	void Finish(std::vector<ID3D12CommandList*>& outLists);
+
+	// Acquire한 리스트에 미리 바인딩할 CBV/SRV/UAV 힙 (nullptr이면 바인딩하지 않음)
+	void SetDescriptorHeap(ID3D12DescriptorHeap* heap) { m_descriptorHeap = heap; }
+
+	size_t GetAcquiredCount() const { return m_acquiredCount; }
+	size_t GetPoolSize() const { return m_entries.size(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Device> m_device;
+	UINT m_frameCount;
+	UINT m_frameIndex = 0;
+
+	std::vector<std::unique_ptr<Entry>> m_entries; // Entry 주소가 바뀌지 않도록 포인터로 보관
+	size_t m_acquiredCount = 0;
+
+	ID3D12DescriptorHeap* m_descriptorHeap = nullptr;
+};
@@ -1,18 +1,27 @@
 #include "D3D12App.h"
-#include "Utils/Utils.h" // ThrowIfFailed, Debug::Print 
-#include "Utils/Timer.h"  // Timer Ŭ
+#include "Utils/Utils.h" // ThrowIfFailed, Debug::Print 등
+#include "Utils/Timer.h"  // Timer 클래스
+#include "Core/JobSystem.h" // JobSystem
+#include "RHI/D3D12RHI.h" // D3D12RHIDevice
+#include "RHI/UploadRingBuffer.h" // UploadRingBuffer
+#include "RHI/UploadService.h" // UploadService
+#include "RHI/PipelineCache.h" // PipelineCache
+#include "Core/BindlessDescriptorHeap.h" // BindlessDescriptorHeap
 #include "Managers/ImGuiManager.h" // ImGui
 #include "D3DX12/d3dx12.h"
 #include "Components/GameObject.h"
 #include "Components/Camera.h"
 
+#include <algorithm>
+
 constexpr float CLEAR_COLOR[] = { 0.0f, 0.2f, 0.4f, 1.0f }; // Clear Color RGBA
 
-// :   ʱȭ
-D3D12App::D3D12App(HINSTANCE hInstance)
+// 생성자: 멤버 변수 초기화
+D3D12App::D3D12App(HINSTANCE hInstance, UINT framesInFlight)
 	: m_hInstance(hInstance),
 	m_hWnd(nullptr),
 	m_rtvDescriptorSize(0),
+	m_frameCount((std::clamp)(framesInFlight, 2u, MAX_FRAMES_IN_FLIGHT)),
 	m_frameIndex(0),
 	m_fenceValue(0),
 	m_fenceEvent(nullptr),
@@ -22,20 +31,49 @@ D3D12App::D3D12App(HINSTANCE hInstance)
 	m_scissorRect = {};
 }
 
-// Ҹ: GPU ȭ  ڵ 
+// 소멸자: GPU 동기화 및 핸들 해제
 D3D12App::~D3D12App()
 {
 	// Ensure that the GPU is no longer referencing resources
 	WaitForGPU();
 	CloseHandle(m_fenceEvent);
+
+	// 이번 실행에 새로 컴파일한 파이프라인을 디스크 라이브러리에 남깁니다.
+	if (m_rhiDevice)
+	{
+		static_cast<D3D12RHIDevice*>(m_rhiDevice.get())->SavePipelineLibrary();
+	}
+}
+
+// 자식 클래스의 리소스가 파괴되기 전에 GPU를 비웁니다. (~MyGame 등에서 호출)
+void D3D12App::Shutdown()
+{
+	if (m_isShutdown) return;
+	m_isShutdown = true;
+
+	// InitBase 전에 실패했으면 기다릴 큐가 없습니다.
+	if (m_commandQueue && m_fence)
+	{
+		// Copy 큐에 남은 복사가 Default 힙의 버퍼를 아직 쓰고 있을 수 있습니다.
+		if (m_uploadService)
+		{
+			m_uploadService->WaitForIdle();
+		}
+		WaitForGPU();
+	}
+
+	OnShutdown();
 }
 
-// ''   ü ʱȭմϴ.
+// '엔진'의 모든 공통 객체를 초기화합니다.
 bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 {
 	m_hWnd = hWnd;
 	using namespace Microsoft::WRL;
 
+	// 워커 스레드 생성 (하드웨어 스레드 수 - 1)
+	m_jobSystem = std::make_unique<JobSystem>();
+
 #ifdef _DEBUG
 	ComPtr<ID3D12Debug> debugController;
 	ThrowIfFailed(D3D12GetDebugInterface(IID_PPV_ARGS(&debugController)));
@@ -55,7 +93,7 @@ bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 
 	// Create Swap Chain
 	DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
-	swapChainDesc.BufferCount = FRAME_COUNT;
+	swapChainDesc.BufferCount = m_frameCount;
 	swapChainDesc.Width = width;
 	swapChainDesc.Height = height;
 	swapChainDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -84,7 +122,7 @@ bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 	// Create RTV Heap
 	{
 		D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
-		rtvHeapDesc.NumDescriptors = FRAME_COUNT;
+		rtvHeapDesc.NumDescriptors = m_frameCount;
 		rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
 		rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
 		m_device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&m_rtvHeap));
@@ -100,12 +138,12 @@ bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 		ThrowIfFailed(m_device->CreateDescriptorHeap(&dsvHeapDesc, IID_PPV_ARGS(&m_dsvHeap)));
 	}
 
-	// RTV/DSV  Resize() Լ óϵ մϴ.
-	// Resize RTV DSV ()մϴ.
+	// RTV/DSV 생성은 Resize() 함수가 처리하도록 위임합니다.
+	// Resize는 RTV와 DSV를 (재)생성합니다.
 	Resize(width, height);
 
 	// Create Command Allocators
-	for (UINT n = 0; n < FRAME_COUNT; n++)
+	for (UINT n = 0; n < m_frameCount; n++)
 	{
 		ThrowIfFailed(m_device->CreateCommandAllocator(
 			D3D12_COMMAND_LIST_TYPE_DIRECT,
@@ -121,14 +159,31 @@ bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 		nullptr,
 		IID_PPV_ARGS(&m_commandList)
 	));
-	m_commandList->Close(); //  ݽϴ. Render() Reset() Դϴ.
+	m_commandList->Close(); // 즉시 닫습니다. Render()에서 Reset()할 것입니다.
+
+	// 씬 그리기를 청크별로 나눠 기록할 커맨드 리스트 풀 (리스트마다 프레임별 할당자)
+	m_commandListPool = std::make_unique<CommandListPool>(m_device.Get(), m_frameCount);
+
+	// RHI: 위에서 만든 디바이스/큐를 감쌉니다.
+	auto rhiDevice = std::make_unique<D3D12RHIDevice>(m_device.Get(), m_commandQueue.Get());
+	const bool pipelineLibraryLoaded = rhiDevice->LoadPipelineLibrary(GetExeDirectoryWstring() + L"\\PipelineCache.bin");
+	Debug::Print(pipelineLibraryLoaded ? L"Pipeline Library Loaded!" : L"Pipeline Library Not Found (pipelines will be compiled)");
+	m_rhiDevice = std::move(rhiDevice);
+	m_pipelineCache = std::make_unique<PipelineCache>(*m_rhiDevice);
+	m_frameUploadRing = std::make_unique<UploadRingBuffer>(*m_rhiDevice, FRAME_UPLOAD_RING_SIZE);
+	m_uploadService = std::make_unique<UploadService>(*m_rhiDevice, STATIC_UPLOAD_STAGING_SIZE);
+
+	// 공용 디스크립터 힙: 풀의 모든 리스트가 이 힙을 바인딩한 채로 시작합니다.
+	m_descriptorHeap = std::make_unique<BindlessDescriptorHeap>(m_device.Get(),
+		PERSISTENT_DESCRIPTOR_COUNT, TRANSIENT_DESCRIPTOR_COUNT, m_frameCount);
+	m_commandListPool->SetDescriptorHeap(m_descriptorHeap->GetHeap());
 
 #if defined(_EDITOR_MODE)
-	// ImGui ʱȭ
+	// ImGui 초기화
 	m_imguiManager = std::make_unique<ImGuiManager>
-		(m_device.Get(), m_commandQueue.Get(), hWnd, FRAME_COUNT);
+		(m_device.Get(), m_commandQueue.Get(), hWnd, m_frameCount, *m_descriptorHeap);
 
-	//  ī޶ 
+	// 에디터 카메라 생성
 	m_editorCameraObject = std::make_unique<GameObject>("Editor Camera");
 	m_editorCameraObject->GetTransform()->SetPosition(0.0f, 5.0f, -10.0f);
 	m_editorCamera = m_editorCameraObject->AddComponent<Camera>();
@@ -146,10 +201,18 @@ bool D3D12App::InitBase(HWND hWnd, UINT width, UINT height)
 
 void D3D12App::Render()
 {
-	// 1. []  غ
+	// 1. [엔진] 프레임 준비
+	m_frameUploadRing->BeginFrame(m_fence->GetCompletedValue()); // GPU가 끝낸 프레임의 업로드 구간 반납
+	m_descriptorHeap->BeginFrame(m_frameIndex, m_fence->GetCompletedValue()); // 디스크립터 반납 + 이번 프레임 임시 구간 되감기
 	ThrowIfFailed(m_commandAllocators[m_frameIndex]->Reset());
 	ThrowIfFailed(m_commandList->Reset(m_commandAllocators[m_frameIndex].Get(), nullptr));
 
+	ID3D12DescriptorHeap* descriptorHeaps[] = { m_descriptorHeap->GetHeap() };
+	m_commandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
+	m_commandListPool->BeginFrame(m_frameIndex);
+
+	// 이번 프레임은 [m_commandList: 전환/클리어] -> [씬 청크 리스트들] -> [마무리 리스트: 전환/ImGui] 순서로 제출합니다.
+	m_sceneTargets.clear();
 
 	auto barrierFromPresentToRenderTarget = CD3DX12_RESOURCE_BARRIER::Transition(
 		m_renderTargetBuffers[m_frameIndex].Get(),
@@ -261,6 +324,16 @@ void D3D12App::Render()
 	ImGui::Begin("Console");
 	ImGui::End();
 
+	// 두 뷰(Scene, Game)를 한 번에 준비합니다. 월드 행렬/바운딩 볼륨은 여기서 한 번만 계산됩니다.
+	{
+		RenderView views[2];
+		size_t viewCount = 0;
+		if (m_editorCamera) views[viewCount++] = { m_editorCamera, m_editorViewportSize.x, m_editorViewportSize.y };
+		if (m_gameCamera) views[viewCount++] = { m_gameCamera, m_gameViewportSize.x, m_gameViewportSize.y };
+		PrepareViews(views, viewCount);
+	}
+
+	// RTT를 렌더 타겟으로 전환하고 지우는 것까지는 메인 리스트에서, 그리기는 씬 청크 리스트에서 합니다.
 	if (m_editorCamera)
 	{
 		D3D12_RESOURCE_BARRIER barrierToRenderTarget = CD3DX12_RESOURCE_BARRIER::Transition(
@@ -270,23 +343,6 @@ void D3D12App::Render()
 
 		m_commandList->ResourceBarrier(1, &barrierToRenderTarget);
 
-		m_commandList->OMSetRenderTargets(1,
-			&m_editorRtvHandle,
-			FALSE,
-			&m_editorDsvHandle);
-
-		D3D12_VIEWPORT editorViewport = {0, 0,
-			m_editorViewportSize.x,
-			m_editorViewportSize.y,
-			0.0f, 1.0f };
-
-		D3D12_RECT editorScissor = {0, 0,
-			static_cast<LONG>(m_editorViewportSize.x),
-			static_cast<LONG>(m_editorViewportSize.y)};
-
-		m_commandList->RSSetViewports(1, &editorViewport);
-		m_commandList->RSSetScissorRects(1, &editorScissor);
-
 		m_commandList->ClearRenderTargetView(
 			m_editorRtvHandle,
 			CLEAR_COLOR,
@@ -298,14 +354,16 @@ void D3D12App::Render()
 			1.0f, 0,
 			0, nullptr);
 
-		Render3DScene(*m_editorCamera);
+		D3D12_VIEWPORT editorViewport = {0, 0,
+			m_editorViewportSize.x,
+			m_editorViewportSize.y,
+			0.0f, 1.0f };
 
-		D3D12_RESOURCE_BARRIER barrierToShaderResource = CD3DX12_RESOURCE_BARRIER::Transition(
-			m_editorTexture.Get(),
-			D3D12_RESOURCE_STATE_RENDER_TARGET,
-			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+		D3D12_RECT editorScissor = {0, 0,
+			static_cast<LONG>(m_editorViewportSize.x),
+			static_cast<LONG>(m_editorViewportSize.y)};
 
-		m_commandList->ResourceBarrier(1, &barrierToShaderResource);
+		m_sceneTargets.push_back({ m_editorCamera, m_editorRtvHandle, m_editorDsvHandle, editorViewport, editorScissor });
 	}
 
 	if (m_gameCamera)
@@ -316,24 +374,7 @@ void D3D12App::Render()
 			D3D12_RESOURCE_STATE_RENDER_TARGET);
 
 		m_commandList->ResourceBarrier(1, &barrierToRenderTarget);
-		
-		m_commandList->OMSetRenderTargets(1,
-			&m_gameRtvHandle,
-			FALSE,
-			&m_gameDsvHandle);
-		
-		D3D12_VIEWPORT gameViewport = { 0, 0,
-			m_gameViewportSize.x,
-			m_gameViewportSize.y,
-			0.0f, 1.0f };
-		
-		D3D12_RECT gameScissor = { 0, 0,
-			static_cast<LONG>(m_gameViewportSize.x),
-			static_cast<LONG>(m_gameViewportSize.y) };
-		
-		m_commandList->RSSetViewports(1, &gameViewport);
-		m_commandList->RSSetScissorRects(1, &gameScissor);
-		
+
 		m_commandList->ClearRenderTargetView(
 			m_gameRtvHandle,
 			CLEAR_COLOR,
@@ -344,29 +385,57 @@ void D3D12App::Render()
 			D3D12_CLEAR_FLAG_DEPTH,
 			1.0f, 0,
 			0, nullptr);
+
+		D3D12_VIEWPORT gameViewport = { 0, 0,
+			m_gameViewportSize.x,
+			m_gameViewportSize.y,
+			0.0f, 1.0f };
 		
-		Render3DScene(*m_gameCamera);
+		D3D12_RECT gameScissor = { 0, 0,
+			static_cast<LONG>(m_gameViewportSize.x),
+			static_cast<LONG>(m_gameViewportSize.y) };
+
+		m_sceneTargets.push_back({ m_gameCamera, m_gameRtvHandle, m_gameDsvHandle, gameViewport, gameScissor });
+	}
 
+	// 2. [엔진] 씬 그리기를 워커 스레드에서 병렬로 기록
+	RecordSceneTargets();
+
+	// 3. [엔진] 마무리 리스트: RTT를 다시 셰이더 리소스로 돌리고, 백 버퍼에 ImGui를 그립니다.
+	ID3D12GraphicsCommandList* finalCommandList = m_commandListPool->Acquire().Native.Get();
+
+	if (m_editorCamera)
+	{
+		D3D12_RESOURCE_BARRIER barrierToShaderResource = CD3DX12_RESOURCE_BARRIER::Transition(
+			m_editorTexture.Get(),
+			D3D12_RESOURCE_STATE_RENDER_TARGET,
+			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+		finalCommandList->ResourceBarrier(1, &barrierToShaderResource);
+	}
+
+	if (m_gameCamera)
+	{
 		D3D12_RESOURCE_BARRIER barrierToShaderResource = CD3DX12_RESOURCE_BARRIER::Transition(
 			m_gameTexture.Get(),
 			D3D12_RESOURCE_STATE_RENDER_TARGET,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 
-		m_commandList->ResourceBarrier(1, &barrierToShaderResource);
+		finalCommandList->ResourceBarrier(1, &barrierToShaderResource);
 	}
 
 	{
 		auto rtvHandle = GetCurrentBackBufferRtv();
 		auto dsvHandle = GetCurrentDsv();
-		m_commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
+		finalCommandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
 		// Set viewport and scissor rect
-		m_commandList->RSSetViewports(1, &m_viewport);
-		m_commandList->RSSetScissorRects(1, &m_scissorRect);
+		finalCommandList->RSSetViewports(1, &m_viewport);
+		finalCommandList->RSSetScissorRects(1, &m_scissorRect);
 
 		// Clear the render target and depth stencil
-		m_commandList->ClearRenderTargetView(rtvHandle, CLEAR_COLOR, 0, nullptr);
-		m_commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+		finalCommandList->ClearRenderTargetView(rtvHandle, CLEAR_COLOR, 0, nullptr);
+		finalCommandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
 
 		ImGui::Begin("Scene");
 		ImGui::Image(m_editorViewImGuiHandle, m_editorViewportSize);
@@ -376,7 +445,7 @@ void D3D12App::Render()
 		ImGui::End();
 
 		// Render the ImGui Scene Viewport
-		m_imguiManager->Render(m_commandList.Get());
+		m_imguiManager->Render(finalCommandList);
 	}
 
 #else
@@ -384,63 +453,136 @@ void D3D12App::Render()
 	auto rtvHandle = GetCurrentBackBufferRtv();
 	auto dsvHandle = GetCurrentDsv();
 
-	m_commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
-	m_commandList->RSSetViewports(1, &m_viewport);
-	m_commandList->RSSetScissorRects(1, &m_scissorRect);
-
 	// Clear the render target and depth stencil
-	m_commandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
+	m_commandList->ClearRenderTargetView(rtvHandle, CLEAR_COLOR, 0, nullptr);
 	m_commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
 
 	if (m_gameCamera)
 	{
-		Render3DScene(*m_gameCamera);
+		const RenderView view = { m_gameCamera, m_viewport.Width, m_viewport.Height };
+		PrepareViews(&view, 1);
+		m_sceneTargets.push_back({ m_gameCamera, rtvHandle, dsvHandle, m_viewport, m_scissorRect });
 	}
 
+	// 2. [엔진] 씬 그리기를 워커 스레드에서 병렬로 기록
+	RecordSceneTargets();
+
+	// 3. [엔진] 마무리 리스트
+	ID3D12GraphicsCommandList* finalCommandList = m_commandListPool->Acquire().Native.Get();
+
 #endif // _EDITOR_MODE
 
-	//  
-	// ҽ  ȯ (Render Target -> Present)
+	// 프레임 제출
+	// 리소스 상태 전환 (Render Target -> Present)
 	auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
 		m_renderTargetBuffers[m_frameIndex].Get(),
 		D3D12_RESOURCE_STATE_RENDER_TARGET,
 		D3D12_RESOURCE_STATE_PRESENT
 	);
-	m_commandList->ResourceBarrier(1, &barrier);
+	finalCommandList->ResourceBarrier(1, &barrier);
 
+	// 메인 리스트 -> 풀에서 받은 순서 그대로, 한 번의 ExecuteCommandLists로 제출합니다.
 	ThrowIfFailed(m_commandList->Close());
-	ID3D12CommandList* ppCommandLists[] = { m_commandList.Get() };
-	m_commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
+	m_submitLists.clear();
+	m_submitLists.push_back(m_commandList.Get());
+	m_commandListPool->Finish(m_submitLists);
 
-	//  ü Present    ̵
+	// 이번 프레임까지 쌓인 업로드를 Copy 큐에 내보내고, Direct 큐가 그 복사를 기다린 뒤 실행하게 합니다.
+	m_uploadService->Flush(m_rhiDevice->GetQueue(RHIQueueType::Direct));
+	m_commandQueue->ExecuteCommandLists(static_cast<UINT>(m_submitLists.size()), m_submitLists.data());
+
+	// 스왑 체인 Present 및 다음 프레임으로 이동
 	ThrowIfFailed(m_swapChain->Present(1, 0)); // VSync
 	MoveToNextFrame();
 }
 
+// m_sceneTargets의 각 뷰를 게임이 원하는 수만큼 청크로 나눠, 청크마다 풀의 리스트 하나에 병렬로 기록합니다.
+// 리스트는 메인 스레드에서 뷰/청크 순서대로 받아 두므로 제출 순서가 기록 순서와 상관없이 결정적입니다.
+void D3D12App::RecordSceneTargets()
+{
+	m_sceneRecordJobs.clear();
+	for (const SceneTarget& target : m_sceneTargets)
+	{
+		const size_t chunkCount = (std::max)(GetRender3DSceneChunkCount(*target.ViewCamera), size_t(1));
+		for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			m_sceneRecordJobs.push_back({ &target, &m_commandListPool->Acquire(), chunk, chunkCount });
+		}
+	}
+
+	m_jobSystem->ParallelFor(m_sceneRecordJobs.size(), 1, [this](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			const SceneRecordJob& job = m_sceneRecordJobs[i];
+			const SceneTarget& target = *job.Target;
+
+			// 커맨드 리스트끼리는 상태가 이어지지 않으므로 청크마다 렌더 타겟/뷰포트를 다시 설정합니다.
+			ID3D12GraphicsCommandList* commandList = job.CommandList->Native.Get();
+			commandList->OMSetRenderTargets(1, &target.Rtv, FALSE, &target.Dsv);
+			commandList->RSSetViewports(1, &target.Viewport);
+			commandList->RSSetScissorRects(1, &target.ScissorRect);
+
+			Render3DScene(*target.ViewCamera, *job.CommandList->RHI, job.ChunkIndex, job.ChunkCount);
+		}
+	});
+}
+
 void D3D12App::MoveToNextFrame()
 {
-	const UINT64 fence = ++m_fenceValue; //  
+	// 이번 프레임이 끝나면 올라갈 값을 이번 프레임 인덱스에 기록해 둡니다.
+	const UINT64 fence = ++m_fenceValue; // 다음 값
 	ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), fence));
+	m_frameFenceValues[m_frameIndex] = fence;
+	m_frameUploadRing->EndFrame(fence); // 이번 프레임의 업로드 구간은 이 펜스를 지나면 재사용
+	m_descriptorHeap->EndFrame(fence);  // 이번 프레임에 해제한 디스크립터도 마찬가지
 
 	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 
-	if (m_fence->GetCompletedValue() < fence)
+	// 다음에 쓸 프레임 인덱스(백 버퍼, 커맨드 할당자)를 마지막으로 쓴 프레임만 기다립니다.
+	// 방금 제출한 프레임은 기다리지 않으므로 그동안 CPU는 다음 프레임을 기록할 수 있습니다.
+	const UINT64 frameFence = m_frameFenceValues[m_frameIndex];
+	if (m_fence->GetCompletedValue() < frameFence)
 	{
-		ThrowIfFailed(m_fence->SetEventOnCompletion(fence, m_fenceEvent));
+		ThrowIfFailed(m_fence->SetEventOnCompletion(frameFence, m_fenceEvent));
 		WaitForSingleObject(m_fenceEvent, INFINITE);
 	}
+
+	ReleaseRetiredResources(m_fence->GetCompletedValue());
 }
 
-// GPU   ó  ٸ
+// GPU가 모든 명령을 처리할 때까지 기다린다
 void D3D12App::WaitForGPU()
 {
 	const UINT64 fence = ++m_fenceValue;
 	ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), fence));
 	ThrowIfFailed(m_fence->SetEventOnCompletion(fence, m_fenceEvent));
 	WaitForSingleObject(m_fenceEvent, INFINITE);
+
+	ReleaseRetiredResources(fence);
+}
+
+void D3D12App::RetireResource(Microsoft::WRL::ComPtr<IUnknown> object)
+{
+	// 지금 기록 중인 프레임은 MoveToNextFrame에서 m_fenceValue + 1을 Signal합니다.
+	m_retiredResources.push_back({ m_fenceValue + 1, std::move(object), nullptr });
+}
+
+void D3D12App::RetireResource(std::unique_ptr<RHIResource> resource)
+{
+	m_retiredResources.push_back({ m_fenceValue + 1, nullptr, std::move(resource) });
+}
+
+// 펜스 값 순서로 쌓이므로 앞에서부터 완료된 것만 해제합니다.
+void D3D12App::ReleaseRetiredResources(UINT64 completedFenceValue)
+{
+	while (!m_retiredResources.empty() && m_retiredResources.front().FenceValue <= completedFenceValue)
+	{
+		m_retiredResources.pop_front();
+	}
 }
 
-// Resize Լ Ͽ ' (DSV)' ϵ ׸ մϴ.
+// Resize 함수를 수정하여 '깊이 버퍼(DSV)'도 재생성하도록 버그를 수정합니다.
 void D3D12App::Resize(UINT width, UINT height)
 {
 	if (width == 0 || height == 0 || (width == m_viewport.Width && height == m_viewport.Height))
@@ -448,17 +590,17 @@ void D3D12App::Resize(UINT width, UINT height)
 
 	WaitForGPU();
 
-	// RTV  
-	for (UINT n = 0; n < FRAME_COUNT; n++)
+	// RTV 버퍼 해제
+	for (UINT n = 0; n < m_frameCount; n++)
 	{
 		m_renderTargetBuffers[n].Reset();
 	}
-	// DSV ۵ ݵ ؾ մϴ.
+	// DSV 버퍼도 반드시 해제해야 합니다.
 	m_depthStencilBuffer.Reset();
 
-	//  ü  ũ 
+	// 스왑 체인 버퍼 크기 변경
 	ThrowIfFailed(m_swapChain->ResizeBuffers(
-		FRAME_COUNT,
+		m_frameCount,
 		width,
 		height,
 		DXGI_FORMAT_R8G8B8A8_UNORM,
@@ -467,24 +609,24 @@ void D3D12App::Resize(UINT width, UINT height)
 
 	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 
-	// RTV 
+	// RTV 재생성
 	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_rtvHeap->GetCPUDescriptorHandleForHeapStart();
 
-	// RTV    (ImGUI SRGB)
+	// RTV 생성 설명자 설정 (ImGUI용 SRGB)
 	D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
 	rtvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
 	rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
 	rtvDesc.Texture2D.MipSlice = 0;
 	rtvDesc.Texture2D.PlaneSlice = 0;
 
-	for (UINT n = 0; n < FRAME_COUNT; n++)
+	for (UINT n = 0; n < m_frameCount; n++)
 	{
 		m_swapChain->GetBuffer(n, IID_PPV_ARGS(&m_renderTargetBuffers[n]));
 		m_device->CreateRenderTargetView(m_renderTargetBuffers[n].Get(), &rtvDesc, rtvHandle);
 		rtvHandle.ptr += m_rtvDescriptorSize;
 	}
 
-	// DSV 
+	// DSV 재생성
 	D3D12_RESOURCE_DESC depthStencilDesc = {};
 	depthStencilDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
 	depthStencilDesc.Width = width;
@@ -509,13 +651,13 @@ void D3D12App::Resize(UINT width, UINT height)
 		&optClear,
 		IID_PPV_ARGS(&m_depthStencilBuffer)));
 
-	// DSV  DSV 
+	// DSV 힙에 DSV 생성
 	m_device->CreateDepthStencilView(m_depthStencilBuffer.Get(), nullptr, m_dsvHeap->GetCPUDescriptorHandleForHeapStart());
 
-	// Ʈ   Ʈ Ʈ
+	// 뷰포트 및 시저 렉트 업데이트
 	SetViewportAndScissorRect(width, height);
 
-	// [ Լ ȣ] ''  ˸
+	// [가상 함수 호출] '게임'에게 리사이즈를 알림
 	OnResize(width, height);
 }
 
@@ -537,90 +679,90 @@ void D3D12App::SetViewportAndScissorRect(UINT width, UINT height)
 void D3D12App::CreateRttResources()
 {
 #if defined(_EDITOR_MODE)
-	// Render To Texture   
+	// Render To Texture용 뷰 힙 생성
 	D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
-	rtvHeapDesc.NumDescriptors = 2; // Scene View 1 + Game View 1
+	rtvHeapDesc.NumDescriptors = 2; // Scene View용 1개 + Game View 1개
 	rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
 	rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
 	ThrowIfFailed(m_device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&m_rttRtvHeap)));
 
 	D3D12_DESCRIPTOR_HEAP_DESC dsvHeapDesc = {};
-	dsvHeapDesc.NumDescriptors = 2; // Scene View 1 + Game View 1
+	dsvHeapDesc.NumDescriptors = 2; // Scene View용 1개 + Game View 1개
 	dsvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
 	dsvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
 	ThrowIfFailed(m_device->CreateDescriptorHeap(&dsvHeapDesc, IID_PPV_ARGS(&m_rttDsvHeap)));
 
-	// RTT ҽ ⺻ Ŭ  
+	// RTT 리소스의 기본 클리어 색상 설정
 	D3D12_CLEAR_VALUE rtvClearValue = {};
 	rtvClearValue.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-	std::copy(std::begin(CLEAR_COLOR), std::end(CLEAR_COLOR), rtvClearValue.Color); // RGBA 
+	std::copy(std::begin(CLEAR_COLOR), std::end(CLEAR_COLOR), rtvClearValue.Color); // RGBA 복사
 
 	D3D12_CLEAR_VALUE dsvClearValue = {};
 	dsvClearValue.Format = DXGI_FORMAT_D32_FLOAT;
 	dsvClearValue.DepthStencil.Depth = 1.0f;
 	dsvClearValue.DepthStencil.Stencil = 0;
 
-	//  ڵ ּ 
+	// 힙 핸들 주소 계산
 	UINT rtvDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 	UINT dsvDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
 
-	m_editorRtvHandle = m_rttRtvHeap->GetCPUDescriptorHandleForHeapStart(); // 0 
-	m_editorDsvHandle = m_rttDsvHeap->GetCPUDescriptorHandleForHeapStart(); // 0 
+	m_editorRtvHandle = m_rttRtvHeap->GetCPUDescriptorHandleForHeapStart(); // 0번 슬롯
+	m_editorDsvHandle = m_rttDsvHeap->GetCPUDescriptorHandleForHeapStart(); // 0번 슬롯
 	
-	m_gameRtvHandle = m_editorRtvHandle; // 0 
-	m_gameRtvHandle.ptr += rtvDescriptorSize; // 1ĭ ̵
+	m_gameRtvHandle = m_editorRtvHandle; // 0번 복사
+	m_gameRtvHandle.ptr += rtvDescriptorSize; // 1칸 이동
 
-	m_gameDsvHandle = m_editorDsvHandle; // 0 
-	m_gameDsvHandle.ptr += dsvDescriptorSize; // 1ĭ ̵
+	m_gameDsvHandle = m_editorDsvHandle; // 0번 복사
+	m_gameDsvHandle.ptr += dsvDescriptorSize; // 1칸 이동
 
-	// Scene View RTT ؽó 
-	// D3D12_RESOURCE_DESC 
+	// Scene View용 RTT 텍스처 생성
+	// D3D12_RESOURCE_DESC 설정
 	auto sceneTexDesc = CD3DX12_RESOURCE_DESC::Tex2D(
-		DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, // 
-		static_cast<UINT64>(m_editorViewportSize.x), //(), // ӽ ũ
+		DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, // 포맷
+		static_cast<UINT64>(m_editorViewportSize.x), //(), // 임시 크기
 		static_cast<UINT>(m_editorViewportSize.y),
 		1, 0, 1, 0,
 		D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET
 	);
 
-	// CreateCommittedResource ȣ
+	// CreateCommittedResource 호출
 	auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
 	
 	ThrowIfFailed(m_device->CreateCommittedResource(
 		&heapProps,
 		D3D12_HEAP_FLAG_NONE,
 		&sceneTexDesc,
-		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,	// ImGui   ֵ ʱ 
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,	// ImGui가 읽을 수 있도록 초기 상태
 		&rtvClearValue,
 		IID_PPV_ARGS(&m_editorTexture)
 	));
 
 	m_device->CreateRenderTargetView(m_editorTexture.Get(), nullptr, m_editorRtvHandle);
 
-	// Scene   
+	// Scene 깊이 버퍼 생성
 	auto sceneDepthDesc = CD3DX12_RESOURCE_DESC::Tex2D(
-		DXGI_FORMAT_D32_FLOAT,	//  
+		DXGI_FORMAT_D32_FLOAT,	// 깊이 포맷
 		static_cast<UINT64>(m_editorViewportSize.x),
 		static_cast<UINT>(m_editorViewportSize.y),
 		1, 0, 1, 0,
-		D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL //  ٽ 
+		D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL // 깊이 스텐실 허용
 	);
 
 	ThrowIfFailed(m_device->CreateCommittedResource(
 		&heapProps,
 		D3D12_HEAP_FLAG_NONE,
 		&sceneDepthDesc,
-		D3D12_RESOURCE_STATE_DEPTH_WRITE,	//   · 
+		D3D12_RESOURCE_STATE_DEPTH_WRITE,	// 깊이 쓰기 상태로 시작
 		&dsvClearValue,
 		IID_PPV_ARGS(&m_editorDepthBuffer)
 	));
 
 	m_device->CreateDepthStencilView(m_editorDepthBuffer.Get(), nullptr, m_editorDsvHandle);
 
-	// Game View RTT ؽó 
+	// Game View용 RTT 텍스처 생성
 	auto gameTexDesc = CD3DX12_RESOURCE_DESC::Tex2D(
-		DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, // 
-		static_cast<UINT64>(m_gameViewportSize.x), // ӽ ũ
+		DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, // 포맷
+		static_cast<UINT64>(m_gameViewportSize.x), // 임시 크기
 		static_cast<UINT>(m_gameViewportSize.y),
 		1, 0, 1, 0,
 		D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET
@@ -629,27 +771,27 @@ void D3D12App::CreateRttResources()
 		&heapProps,
 		D3D12_HEAP_FLAG_NONE,
 		&gameTexDesc,
-		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,	// ImGui   ֵ ʱ 
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,	// ImGui가 읽을 수 있도록 초기 상태
 		&rtvClearValue,
 		IID_PPV_ARGS(&m_gameTexture)
 	));
 	m_device->CreateRenderTargetView(m_gameTexture.Get(), nullptr, m_gameRtvHandle);
 	
-	// Game   
+	// Game 깊이 버퍼 생성
 	auto gameDepthDesc = CD3DX12_RESOURCE_DESC::Tex2D(
-		DXGI_FORMAT_D32_FLOAT,	//  
+		DXGI_FORMAT_D32_FLOAT,	// 깊이 포맷
 		static_cast<UINT64>(m_gameViewportSize.x),
 		static_cast<UINT>(m_gameViewportSize.y),
 		1, 0, 1, 0,
-		D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL //  ٽ 
+		D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL // 깊이 스텐실 허용
 	);
 
-	// CreateCommittedResource ȣ
+	// CreateCommittedResource 호출
 	ThrowIfFailed(m_device->CreateCommittedResource(
 		&heapProps,
 		D3D12_HEAP_FLAG_NONE,
 		&gameDepthDesc,
-		D3D12_RESOURCE_STATE_DEPTH_WRITE,	//   · 
+		D3D12_RESOURCE_STATE_DEPTH_WRITE,	// 깊이 쓰기 상태로 시작
 		&dsvClearValue,
 		IID_PPV_ARGS(&m_gameDepthBuffer)
 	));
@@ -659,7 +801,7 @@ void D3D12App::CreateRttResources()
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12App::GetCurrentBackBufferRtv() const
 {
-	//   RTV ڵ ȯ
+	// 현재 프레임의 RTV 핸들 반환
 	CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_rtvHeap->GetCPUDescriptorHandleForHeapStart());
 	
 	// Offset by frame index
@@ -671,5 +813,5 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12App::GetCurrentBackBufferRtv() const
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12App::GetCurrentDsv() const
 {
-	return m_dsvHeap->GetCPUDescriptorHandleForHeapStart(); // DSV  ϳ DSV 
+	return m_dsvHeap->GetCPUDescriptorHandleForHeapStart(); // DSV 힙에는 하나의 DSV만 존재
 }
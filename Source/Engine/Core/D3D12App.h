@@ -2,9 +2,12 @@
 
 #include <windows.h>
 #include <wrl.h>
+#include <deque>
 #include <memory>
 #include <vector>
 #include "imgui.h" // ImGui::ImTextureID
+#include "RHI/RHI.h"
+#include "Core/CommandListPool.h"
 
 #include <d3d12.h>
 #include <dxgi1_6.h>
@@ -14,101 +17,167 @@
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3dcompiler.lib")
 
-constexpr UINT FRAME_COUNT = 2; // Double buffering
+// 동시에 진행 중일 수 있는 프레임 수 (= 스왑 체인 버퍼 수). 생성자에서 2~3 중에 고릅니다.
+// 2면 더블 버퍼링, 3이면 GPU가 두 프레임 뒤처져도 CPU가 기다리지 않고 다음 프레임을 기록합니다.
+constexpr UINT MAX_FRAMES_IN_FLIGHT = 3;
+constexpr UINT DEFAULT_FRAMES_IN_FLIGHT = 2;
+constexpr uint64_t FRAME_UPLOAD_RING_SIZE = 4 * 1024 * 1024; // 프레임별 상수용 업로드 링 (256B 상수 기준 약 16K 드로우)
+constexpr uint64_t STATIC_UPLOAD_STAGING_SIZE = 8 * 1024 * 1024; // 정적 버퍼 업로드용 스테이징 (넘치면 나눠서 복사)
+constexpr uint32_t PERSISTENT_DESCRIPTOR_COUNT = 16384; // 텍스처 SRV 등 오래 사는 디스크립터 수
+constexpr uint32_t TRANSIENT_DESCRIPTOR_COUNT = 4096;   // 프레임마다 쓰고 버리는 디스크립터 수 (프레임당)
 
 class GameObject;
 class Camera;
 
-// D3D12App  ' ӿũ' ߻  ŬԴϴ.
-//  Ŭ D3D12 ٽ ü(Device, Queue, SwapChain)
-// ϰ,  (Run) մϴ.
+// 이번 프레임에 그릴 뷰 하나 (카메라 + 그 뷰의 뷰포트 크기)
+struct RenderView
+{
+	const Camera* ViewCamera = nullptr;
+	float ViewportWidth = 0.0f;
+	float ViewportHeight = 0.0f;
+};
+
+// D3D12App은 이제 '엔진 프레임워크'의 추상 기반 클래스입니다.
+// 이 클래스는 D3D12의 핵심 객체들(Device, Queue, SwapChain)을
+// 소유하고, 메인 루프(Run)를 제공합니다.
 class D3D12App
 {
 public:
-	// HWND InitBase() ޹޾ ʱȭմϴ.
-	D3D12App(HINSTANCE hInstance);
+	// HWND는 InitBase()에서 전달받아 초기화합니다.
+	// framesInFlight는 [2, MAX_FRAMES_IN_FLIGHT]로 잘립니다.
+	D3D12App(HINSTANCE hInstance, UINT framesInFlight = DEFAULT_FRAMES_IN_FLIGHT);
 	D3D12App(const D3D12App&) = delete;
 	D3D12App& operator=(const D3D12App&) = delete;
 
-	//   Ҹڴ ʼԴϴ.
+	//상속을 위해 가상 소멸자는 필수입니다.
 	virtual ~D3D12App();
 
-	// InitBase() InitGame() 'ϳ' Init() մϴ.
-		// Game.exe MyGame::Init() ο  InitBase() ȣ Դϴ.
+	// InitBase()와 InitGame()을 '하나'의 Init()으로 통합합니다.
+		// Game.exe의 MyGame::Init()이 내부에서 엔진의 InitBase()를 호출할 것입니다.
 	virtual bool Init(HWND hWnd, UINT width, UINT height) = 0;
 
-	//   ȣ 'Ʈ'
+	// 메인 루프에서 호출될 '업데이트'
 	virtual void Update(float dt) = 0;
 
-	//   ȣ ''
-	// ( DrawGame() Render() ˴ϴ.)
+	// 메인 루프에서 호출될 '렌더링'
+	// (이전의 DrawGame()이 Render()가 됩니다.)
 	void Render();
 
-	// 쿡 ȣ ''
+	// 윈도우에서 호출될 '리사이즈'
 	void Resize(UINT width, UINT height);
 
-	// α׷  
-	virtual void Shutdown() = 0;
+	// 프로그램 종료 시
+	// GPU가 제출된 작업(복사 포함)을 모두 끝낼 때까지 기다린 뒤 OnShutdown()을 부릅니다. 두 번째 호출부터는 아무것도 하지 않습니다.
+	// 자식 클래스는 자기 멤버(배치 리소스 등)가 파괴되기 전에 해제되도록 소멸자에서 반드시 이 함수를 부르세요.
+	void Shutdown();
 
 protected:
-	// [  '' (  Լ)]
-	//  Լ ''  ϴ.
-	// 'Game.exe' ڽ Ŭ ݵ ̵ؾ մϴ.
+	// [게임이 구현할 '약속' (순수 가상 함수)]
+	// 이 함수들은 '엔진'에 구현이 없습니다.
+	// 'Game.exe'의 자식 클래스가 반드시 오버라이드해야 합니다.
 
-	// 1. ӿ Ưȭ ҽ(PSO, Ʈ ñ״ó, ޽) εմϴ.
+	// 1. 게임에 특화된 리소스(PSO, 루트 시그니처, 메쉬)를 로드합니다.
 	bool InitBase(HWND hWnd, UINT width, UINT height);
-	// 2. ׸ (Ŀǵ Ʈ ä)
-	virtual void Render3DScene(const Camera& camera) = 0;
-	// 3. â ũ  
+	// 2. 이번 프레임의 모든 뷰를 Render3DScene 전에 한 번에 준비합니다.
+	//    (뷰와 무관한 작업은 한 번만 하고, 뷰별 컬링/드로우 리스트 구성은 병렬로 할 수 있도록)
+	virtual void PrepareViews([[maybe_unused]] const RenderView* views, [[maybe_unused]] size_t viewCount) {}
+	// 3. 그리기 (커맨드 리스트 채우기)
+	//    한 뷰를 chunkCount개로 나눠 워커 스레드에서 동시에 기록합니다. 각 호출은 자기 몫(chunkIndex)만
+	//    commandList에 기록하면 되며, 렌더 타겟/뷰포트는 엔진이 미리 설정해 둡니다. (스레드 안전해야 함)
+	virtual void Render3DScene(const Camera& camera, RHICommandList& commandList, size_t chunkIndex, size_t chunkCount) = 0;
+	//    이 뷰를 몇 개의 청크로 나눠 기록할지 (PrepareViews 이후 메인 스레드에서 호출)
+	virtual size_t GetRender3DSceneChunkCount([[maybe_unused]] const Camera& camera) const { return 1; }
+	// 4. 창 크기 변경 시
 	virtual void OnResize(UINT width, UINT height) = 0;
+	// 5. 종료 시 (GPU가 모두 끝낸 뒤 Shutdown()이 한 번만 호출)
+	//    게임이 소유한 GPU 리소스를 여기서 해제합니다.
+	virtual void OnShutdown() {}
 
-	// [ ƿƼ]
-	// ڽ Ŭ   ֵ protected մϴ.
+	// [엔진 유틸리티]
+	// 자식 클래스가 사용할 수 있도록 protected로 변경합니다.
 	void WaitForGPU();
 	void MoveToNextFrame();
+
+	// GPU가 '지금 기록 중인 프레임'까지 끝낸 뒤에 해제합니다.
+	// 프레임 도중 교체한 리소스처럼, 이미 제출된 커맨드 리스트가 아직 참조할 수 있는 객체를 넘기세요.
+	void RetireResource(Microsoft::WRL::ComPtr<IUnknown> object);
+	void RetireResource(std::unique_ptr<RHIResource> resource);
+
+	UINT GetFrameCount() const { return m_frameCount; }
 	void SetViewportAndScissorRect(UINT width, UINT height);
 
-	// RTT(Render To Texture)  Լ
+	// RTT(Render To Texture) 관련 함수
 	void CreateRttResources();
+
+	// m_sceneTargets의 뷰들을 청크로 나눠 병렬 기록
+	void RecordSceneTargets();
 	
 	HINSTANCE m_hInstance;
 	HWND m_hWnd;
+	bool m_isShutdown = false;
 
-	// D3D12 ٽ ü
+	// D3D12 핵심 객체들
 	Microsoft::WRL::ComPtr<IDXGIFactory4> m_factory;
 	Microsoft::WRL::ComPtr<ID3D12Device> m_device;
 	Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_commandQueue;
-	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_commandAllocators[FRAME_COUNT];
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_commandAllocators[MAX_FRAMES_IN_FLIGHT];
 	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_commandList;
 	Microsoft::WRL::ComPtr<IDXGISwapChain3> m_swapChain;
 
-	//  Ÿ(RTV) 
+	// 렌더 타겟(RTV) 관련
 	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_rtvHeap;
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_renderTargetBuffers[FRAME_COUNT];
-	UINT m_rtvDescriptorSize; // RTV ũ ũ
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_renderTargetBuffers[MAX_FRAMES_IN_FLIGHT];
+	UINT m_rtvDescriptorSize; // RTV 디스크립터 크기
 
-	//  (DSV) 
+	// 깊이 버퍼(DSV) 관련
 	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_dsvHeap;
 	Microsoft::WRL::ComPtr<ID3D12Resource> m_depthStencilBuffer;
 
-	//   ε
+	// 현재 프레임 인덱스 (= 현재 백 버퍼 인덱스, [0, m_frameCount))
+	UINT m_frameCount;
 	UINT m_frameIndex;
 
-	// GPU ȭ 潺
+	// GPU 동기화용 펜스
+	// m_fenceValue는 마지막으로 Signal한 값이고, m_frameFenceValues[i]는 프레임 인덱스 i를 마지막으로 쓴 프레임이 Signal한 값입니다.
+	// 프레임 인덱스 i를 다시 쓰기 전에는 그 값까지만 기다리면 됩니다.
 	Microsoft::WRL::ComPtr<ID3D12Fence> m_fence;
 	UINT64 m_fenceValue = 0;
+	UINT64 m_frameFenceValues[MAX_FRAMES_IN_FLIGHT] = {};
 	HANDLE m_fenceEvent = nullptr;
 
-	// Ʈ  Ʈ
+	// 뷰포트와 시저 렉트
 	D3D12_VIEWPORT m_viewport;
 	D3D12_RECT m_scissorRect;
 
-	Camera* m_gameCamera;	// Game View  ī޶ ( Ҵ )
+	Camera* m_gameCamera;	// Game View에 사용할 카메라 (게임이 할당해줘야 함)
 
-	//    Ÿ̸ ߰
+	// 게임 루프를 위한 타이머 추가
 	std::unique_ptr<class Timer> m_pTimer;
 
-	// Editor  
+	// 워커 스레드 풀 (공간 인덱스 재구성, 컬링 등 CPU 병렬 작업용)
+	std::unique_ptr<class JobSystem> m_jobSystem;
+
+	// RHI: 위 D3D12 디바이스/큐를 감싼 것. 게임의 리소스 생성은 이쪽을 씁니다.
+	// (그리기 기록은 Render3DScene에 넘겨주는 풀의 커맨드 리스트로 합니다)
+	std::unique_ptr<RHIDevice> m_rhiDevice;
+
+	// 파이프라인은 이 캐시로 만듭니다. 같은 설명이면 같은 파이프라인을 돌려주고,
+	// 디스크 파이프라인 라이브러리(실행 파일 옆 PipelineCache.bin)로 다음 실행의 컴파일을 건너뜁니다.
+	std::unique_ptr<class PipelineCache> m_pipelineCache;
+
+	// 드로우별 상수처럼 한 프레임만 쓰는 업로드 데이터용 링 버퍼.
+	// Render() 시작에서 완료된 펜스까지 반납하고, MoveToNextFrame()의 Signal 값에 이번 프레임 할당을 묶습니다.
+	std::unique_ptr<class UploadRingBuffer> m_frameUploadRing;
+
+	// 정점/인덱스 버퍼 같은 정적 데이터를 Copy 큐로 Default 힙에 올리는 경로.
+	// Render()가 제출 직전에 Flush해서 Direct 큐가 복사 완료를 GPU 쪽에서 기다리게 합니다.
+	std::unique_ptr<class UploadService> m_uploadService;
+
+	// 엔진 공용 셰이더 가시 CBV/SRV/UAV 힙 (영구 구간 + 프레임별 임시 구간). 모든 커맨드 리스트와 ImGui가 이 힙 하나를 씁니다.
+	// Render() 시작에서 완료된 펜스까지의 해제를 반영하고, MoveToNextFrame()의 Signal 값에 이번 프레임 해제를 묶습니다.
+	std::unique_ptr<class BindlessDescriptorHeap> m_descriptorHeap;
+
+	// Editor 전용 멤버들
 #if defined(_EDITOR_MODE)
 
 	// ImGui
@@ -118,28 +187,65 @@ protected:
 	std::unique_ptr<GameObject> m_editorCameraObject;
 	Camera* m_editorCamera = nullptr;
 
-	// Render To Texture ҽ  
-	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_rttRtvHeap;	//  Ÿ  
-	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_rttDsvHeap;  //  ٽ  
-
-	// Scene View RTT ҽ
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_editorTexture; // Scene  Ÿ ؽó
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_editorDepthBuffer; // Scene   ؽó
-	D3D12_CPU_DESCRIPTOR_HANDLE m_editorRtvHandle; // RTT RTV  0 
-	D3D12_CPU_DESCRIPTOR_HANDLE m_editorDsvHandle; // RTT DSV  0 
-	ImTextureID m_editorViewImGuiHandle = 0; // ImGui ؽó ڵ
-	ImVec2 m_editorViewportSize = { 1280, 720 }; // ImGui ǥ  ũ
-
-	// Game View RTT ҽ
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_gameTexture; // Scene  Ÿ ؽó
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_gameDepthBuffer; // Scene   ؽó
-	D3D12_CPU_DESCRIPTOR_HANDLE m_gameRtvHandle; // RTT RTV  1 
-	D3D12_CPU_DESCRIPTOR_HANDLE m_gameDsvHandle; // RTT DSV  1 
-	ImTextureID m_gameViewImGuiHandle = 0; // ImGui ؽó ڵ
-	ImVec2 m_gameViewportSize = { 1280, 720 }; // ImGui ǥ  ũ
+	// Render To Texture용 리소스와 뷰 힙
+	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_rttRtvHeap;	// 렌더 타겟 뷰 힙
+	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_rttDsvHeap;  // 깊이 스텐실 뷰 힙
+
+	// Scene View RTT 리소스
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_editorTexture; // Scene 렌더 타겟 텍스처
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_editorDepthBuffer; // Scene 깊이 버퍼 텍스처
+	D3D12_CPU_DESCRIPTOR_HANDLE m_editorRtvHandle; // RTT RTV 힙의 0번 슬롯
+	D3D12_CPU_DESCRIPTOR_HANDLE m_editorDsvHandle; // RTT DSV 힙의 0번 슬롯
+	ImTextureID m_editorViewImGuiHandle = 0; // ImGui용 텍스처 핸들
+	ImVec2 m_editorViewportSize = { 1280, 720 }; // ImGui에 표시할 때의 크기
+
+	// Game View RTT 리소스
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_gameTexture; // Scene 렌더 타겟 텍스처
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_gameDepthBuffer; // Scene 깊이 버퍼 텍스처
+	D3D12_CPU_DESCRIPTOR_HANDLE m_gameRtvHandle; // RTT RTV 힙의 1번 슬롯
+	D3D12_CPU_DESCRIPTOR_HANDLE m_gameDsvHandle; // RTT DSV 힙의 1번 슬롯
+	ImTextureID m_gameViewImGuiHandle = 0; // ImGui용 텍스처 핸들
+	ImVec2 m_gameViewportSize = { 1280, 720 }; // ImGui에 표시할 때의 크기
 #endif // _EDITOR_MODE
 
 private:
 	D3D12_CPU_DESCRIPTOR_HANDLE GetCurrentBackBufferRtv() const;
 	D3D12_CPU_DESCRIPTOR_HANDLE GetCurrentDsv() const;
+
+	// 이번 프레임에 씬을 그릴 렌더 타겟 하나 (Render()가 채우고 RecordSceneTargets()가 기록)
+	struct SceneTarget
+	{
+		const Camera* ViewCamera = nullptr;
+		D3D12_CPU_DESCRIPTOR_HANDLE Rtv;
+		D3D12_CPU_DESCRIPTOR_HANDLE Dsv;
+		D3D12_VIEWPORT Viewport;
+		D3D12_RECT ScissorRect;
+	};
+
+	// 워커 스레드 하나가 기록할 (뷰, 청크) 한 쌍
+	struct SceneRecordJob
+	{
+		const SceneTarget* Target = nullptr;
+		CommandListPool::Entry* CommandList = nullptr;
+		size_t ChunkIndex = 0;
+		size_t ChunkCount = 1;
+	};
+
+	// RetireResource로 넘겨받아 펜스 값이 지나기를 기다리는 객체
+	struct RetiredResource
+	{
+		UINT64 FenceValue = 0;
+		Microsoft::WRL::ComPtr<IUnknown> Object;
+		std::unique_ptr<RHIResource> Resource;
+	};
+
+	void ReleaseRetiredResources(UINT64 completedFenceValue);
+
+	std::deque<RetiredResource> m_retiredResources;
+
+	// 씬 청크와 마무리 작업을 기록할 커맨드 리스트들 (m_commandList 다음 순서로 제출)
+	std::unique_ptr<CommandListPool> m_commandListPool;
+	std::vector<SceneTarget> m_sceneTargets;
+	std::vector<SceneRecordJob> m_sceneRecordJobs;
+	std::vector<ID3D12CommandList*> m_submitLists;
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "JobSystem.h"
+
+JobSystem::JobSystem(uint32_t workerCount)
+{
+	if (workerCount == 0)
+	{
+		const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+	}
+
+	m_workers.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back(&JobSystem::WorkerLoop, this);
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_all();
+
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func)
+{
+	if (count == 0) return;
+
+	grainSize = (grainSize == 0) ? 1 : grainSize;
+	const size_t chunkCount = GetChunkCount(count, grainSize);
+
+	// 청크가 하나뿐이면 스레드를 깨우는 비용이 더 큽니다.
+	if (chunkCount == 1 || m_workers.empty())
+	{
+		for (size_t begin = 0; begin < count; begin += grainSize)
+		{
+			func(begin, (begin + grainSize < count) ? begin + grainSize : count);
+		}
+		return;
+	}
+
+	Batch batch;
+	batch.Remaining.store(chunkCount);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (size_t begin = 0; begin < count; begin += grainSize)
+		{
+			m_queue.push_back({ &func, begin, (begin + grainSize < count) ? begin + grainSize : count, &batch });
+		}
+	}
+	m_condition.notify_all();
+
+	// 기다리는 동안 호출 스레드도 큐의 작업을 처리합니다.
+	// 큐에 batch를 가리키는 작업이 남아 있는 동안에는 (예외가 나도) 여기를 벗어나면 안 됩니다.
+	while (batch.Remaining.load(std::memory_order_acquire) > 0)
+	{
+		if (!TryRunPendingJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (batch.Error)
+	{
+		std::rethrow_exception(batch.Error);
+	}
+}
+
+void JobSystem::WorkerLoop()
+{
+	for (;;)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+
+			if (m_stop && m_queue.empty()) return;
+
+			job = m_queue.front();
+			m_queue.pop_front();
+		}
+
+		Execute(job);
+	}
+}
+
+bool JobSystem::TryRunPendingJob()
+{
+	Job job;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_queue.empty()) return false;
+
+		job = m_queue.front();
+		m_queue.pop_front();
+	}
+
+	Execute(job);
+	return true;
+}
+
+void JobSystem::Execute(const Job& job)
+{
+	Batch& batch = *job.Owner;
+
+	// 앞선 청크가 실패했으면 결과를 어차피 버리므로 건너뜁니다.
+	if (!batch.Failed.load(std::memory_order_relaxed))
+	{
+		try
+		{
+			(*job.Func)(job.Begin, job.End);
+		}
+		catch (...)
+		{
+			// 워커 스레드 밖으로 던지면 프로세스가 종료되므로 잡아 두었다가 호출 스레드에서 다시 던집니다.
+			if (!batch.Failed.exchange(true))
+			{
+				batch.Error = std::current_exception();
+			}
+		}
+	}
+
+	// 성공/실패와 관계없이 항상 줄여야 ParallelFor가 반환합니다. (release: Error 쓰기를 호출 스레드에 보임)
+	batch.Remaining.fetch_sub(1, std::memory_order_release);
+}
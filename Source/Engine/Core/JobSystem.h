@@ -0,0 +1,75 @@
+// JobSystem.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * [JobSystem]
+ * 고정 개수의 워커 스레드를 가진 간단한 스레드 풀입니다.
+ * - ParallelFor는 [0, count)를 grainSize 크기의 청크로 나눠 워커들에게 뿌리고,
+ *   호출한 스레드도 큐의 작업을 함께 처리하면서 모든 청크가 끝날 때까지 기다립니다.
+ *   (호출자가 작업을 돕기 때문에 ParallelFor 안에서 다시 ParallelFor를 불러도 교착되지 않습니다.)
+ * - 청크 경계는 결정적입니다: 청크 c는 [c * grainSize, min((c + 1) * grainSize, count)).
+ *   따라서 청크별 임시 버퍼(예: 카운팅 정렬의 히스토그램)를 begin / grainSize로 찾을 수 있습니다.
+ * - 청크가 예외를 던지면 그 ParallelFor의 남은 청크는 건너뛰고, 모든 청크가 정리된 뒤
+ *   첫 번째 예외를 ParallelFor를 부른 스레드에서 다시 던집니다. (워커 스레드는 계속 살아 있음)
+ */
+class JobSystem
+{
+public:
+	// workerCount = 0이면 (하드웨어 스레드 수 - 1)개를 만듭니다. (호출 스레드 몫 하나를 뺌)
+	explicit JobSystem(uint32_t workerCount = 0);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// 워커 + 호출 스레드
+	uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+	static size_t GetChunkCount(size_t count, size_t grainSize)
+	{
+		grainSize = (grainSize == 0) ? 1 : grainSize;
+		return (count + grainSize - 1) / grainSize;
+	}
+
+	// func(begin, end)를 모든 청크에 대해 호출하고, 전부 끝나면 반환합니다.
+	// func가 던진 예외는 모든 청크가 끝난 뒤 여기서 다시 던집니다.
+	void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func);
+
+private:
+	// ParallelFor 한 번의 공유 상태 (호출자 스택에 있음)
+	struct Batch
+	{
+		std::atomic<size_t> Remaining = 0;
+		std::atomic<bool> Failed = false;
+		std::exception_ptr Error; // Failed를 처음 세운 청크만 씀
+	};
+
+	struct Job
+	{
+		const std::function<void(size_t, size_t)>* Func = nullptr;
+		size_t Begin = 0;
+		size_t End = 0;
+		Batch* Owner = nullptr;
+	};
+
+	void WorkerLoop();
+	bool TryRunPendingJob();
+	static void Execute(const Job& job);
+
+	std::vector<std::thread> m_workers;
+	std::deque<Job> m_queue;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	bool m_stop = false;
+};
@@ -1,6 +1,7 @@
 #include "ImGuiManager.h"
 
 #include "../Utils/Utils.h"
+#include "Core/BindlessDescriptorHeap.h"
 #include "Components/Camera.h"
 #include "imgui.h"
 #include "imgui_impl_win32.h"
@@ -8,30 +9,15 @@
 
 #include <d3d12.h>
 
-ImGuiManager* ImGuiManager::s_instance = nullptr; // ̱ ʱȭ
+ImGuiManager* ImGuiManager::s_instance = nullptr; // 싱글톤 초기화
 
-ImGuiManager::ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, HWND hWnd, const int FRAME_COUNT)
+ImGuiManager::ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, HWND hWnd, const int FRAME_COUNT,
+	BindlessDescriptorHeap& descriptorHeap)
+	: m_descriptorHeap(descriptorHeap)
 {
 	ImGuiManager::s_instance = this;
 	m_device = device;
 
-	// Create ImGui Descriptor Heap
-	D3D12_DESCRIPTOR_HEAP_DESC imguiHeapDesc = {};
-	imguiHeapDesc.NumDescriptors = m_totalHeapSize;
-	imguiHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-	imguiHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-	device->CreateDescriptorHeap(&imguiHeapDesc, IID_PPV_ARGS(&m_imguiDescHeap));
-
-	// Get SRV Descriptor Size
-	m_srvHandleIncrementSize = 
-		device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-	// Ʈ ũ ڵ
-	D3D12_CPU_DESCRIPTOR_HANDLE fontCpuHandle = 
-		m_imguiDescHeap->GetCPUDescriptorHandleForHeapStart();
-	D3D12_GPU_DESCRIPTOR_HANDLE fontGpuHandle = 
-		m_imguiDescHeap->GetGPUDescriptorHandleForHeapStart();
-
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
 
@@ -41,37 +27,39 @@ ImGuiManager::ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, H
 	io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;         // Enable Docking
 	io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;       // Enable Multi-Viewport / Platform Windows
 	
-	// Ÿ 
+	// 스타일 설정
 	ImGui::StyleColorsDark();
 
-	// 鿣 ʱȭ
+	// 백엔드 초기화
 	ImGui_ImplWin32_Init(hWnd);
 
-	m_imGuiDescHeapAlloc.Create(device, m_imguiDescHeap.Get());
-
-	//  ImGui ʱȭ  ( ̻  )
+	// 기존의 ImGui 초기화 방식 (더 이상 사용하지 않음)
 	/*ImGui_ImplDX12_Init(device, FRAME_COUNT, DXGI_FORMAT_R8G8B8A8_UNORM, m_imguiDescHeap.Get(),
 		m_imguiDescHeap->GetCPUDescriptorHandleForHeapStart(), m_imguiDescHeap->GetGPUDescriptorHandleForHeapStart());*/
 
-	// Ʒ ImGui 1.89.5  ϴ ο ʱȭ  (ݹԼ )
+	// 아래는 ImGui 1.89.5 버전부터 지원하는 새로운 초기화 방식 (콜백함수 등록)
 	ImGui_ImplDX12_InitInfo init_info = {};
 	init_info.Device = device;
 	init_info.CommandQueue = cmdQueue;
 	init_info.NumFramesInFlight = FRAME_COUNT;
 	init_info.RTVFormat = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-	init_info.SrvDescriptorHeap = m_imguiDescHeap.Get();
+	init_info.SrvDescriptorHeap = m_descriptorHeap.GetHeap();
 	init_info.SrvDescriptorAllocFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE* cpu, D3D12_GPU_DESCRIPTOR_HANDLE* gpu)
 		{
-			ImGuiManager::s_instance->m_imGuiDescHeapAlloc.Alloc(cpu, gpu);
+			BindlessDescriptorHeap& heap = ImGuiManager::s_instance->m_descriptorHeap;
+			const uint32_t index = heap.AllocatePersistent();
+			*cpu = heap.GetCpuHandle(index);
+			*gpu = heap.GetGpuHandle(index);
 		};
-	init_info.SrvDescriptorFreeFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE cpu, D3D12_GPU_DESCRIPTOR_HANDLE gpu)
+	init_info.SrvDescriptorFreeFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE cpu, D3D12_GPU_DESCRIPTOR_HANDLE)
 		{
-			ImGuiManager::s_instance->m_imGuiDescHeapAlloc.Free(cpu, gpu);
+			BindlessDescriptorHeap& heap = ImGuiManager::s_instance->m_descriptorHeap;
+			heap.FreePersistent(heap.GetIndex(cpu));
 		};
 
 	ImGui_ImplDX12_Init(&init_info);
 
-	// ʱ â ũ 
+	// 초기 창 크기 설정
 	RECT rect;
 	GetClientRect(hWnd, &rect);
 	SendMessage(hWnd, WM_SIZE, SIZE_RESTORED, MAKELPARAM(rect.right - rect.left, rect.bottom - rect.top));
@@ -80,7 +68,6 @@ ImGuiManager::ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, H
 ImGuiManager::~ImGuiManager()
 {
 	ImGui_ImplDX12_Shutdown();
-	m_imGuiDescHeapAlloc.Destroy();
 	ImGui_ImplWin32_Shutdown();
 	ImGui::DestroyContext();
 }
@@ -97,7 +84,8 @@ void ImGuiManager::Render(ID3D12GraphicsCommandList* cmdList)
 {
 	ImGui::Render();
 
-	ID3D12DescriptorHeap* heaps[] = { m_imguiDescHeap.Get() };
+	// D3D12App이 이미 같은 힙을 바인딩했더라도, 다른 힙을 쓰는 코드가 끼어들 수 있으므로 한 번 더 설정합니다.
+	ID3D12DescriptorHeap* heaps[] = { m_descriptorHeap.GetHeap() };
 	cmdList->SetDescriptorHeaps(_countof(heaps), heaps);
 
 	ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), cmdList);
@@ -112,18 +100,8 @@ void ImGuiManager::Render(ID3D12GraphicsCommandList* cmdList)
 
 ImTextureID ImGuiManager::RegisterTexture(ID3D12Resource* pTextureResource)
 {
-	// Check if heap is full
-	if (m_currentHeapIndex >= m_totalHeapSize)
-	{
-		Debug::Print("ImGui Descriptor Heap is Full!");
-		throw std::runtime_error("ImGui Descriptor Heap is Full!");
-	}
-
-	// Create SRV for the texture
-	D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = m_imguiDescHeap->GetCPUDescriptorHandleForHeapStart();
-	cpuHandle.ptr += m_srvHandleIncrementSize * m_currentHeapIndex;
-	D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = m_imguiDescHeap->GetGPUDescriptorHandleForHeapStart();
-	gpuHandle.ptr += m_srvHandleIncrementSize * m_currentHeapIndex;
+	// 영구 구간이 가득 차면 AllocatePersistent가 예외를 던집니다.
+	const uint32_t index = m_descriptorHeap.AllocatePersistent();
 
 	// Describe and create the SRV
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
@@ -132,8 +110,14 @@ ImTextureID ImGuiManager::RegisterTexture(ID3D12Resource* pTextureResource)
 	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
 	srvDesc.Texture2D.MipLevels = 1;
 
-	m_device->CreateShaderResourceView(pTextureResource, &srvDesc, cpuHandle);
+	m_device->CreateShaderResourceView(pTextureResource, &srvDesc, m_descriptorHeap.GetCpuHandle(index));
 
-	m_currentHeapIndex++;
-	return static_cast<ImTextureID>(gpuHandle.ptr);
+	return static_cast<ImTextureID>(m_descriptorHeap.GetGpuHandle(index).ptr);
+}
+
+void ImGuiManager::UnregisterTexture(ImTextureID textureId)
+{
+	D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = {};
+	gpuHandle.ptr = static_cast<UINT64>(textureId);
+	m_descriptorHeap.FreePersistent(m_descriptorHeap.GetIndex(gpuHandle));
 }
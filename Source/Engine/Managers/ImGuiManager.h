@@ -2,26 +2,31 @@
 
 #include <windows.h>
 #include <wrl.h>
-#include "../Utils/DescriptorHeapAllocator.h"
+#include <d3d12.h>
 
+#include "imgui.h"
+
+class BindlessDescriptorHeap;
+
+// ImGui의 폰트/텍스처 SRV는 D3D12App의 BindlessDescriptorHeap 영구 구간에 만듭니다.
+// (씬과 같은 힙을 쓰므로 ImGui를 그릴 때 힙을 바꾸지 않고, 등록할 수 있는 텍스처 수도 그 힙의 크기만큼입니다.)
 class ImGuiManager
 {
 public:
-	ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, HWND hWnd, const int FRAME_COUNT);
+	ImGuiManager(ID3D12Device* device, ID3D12CommandQueue* cmdQueue, HWND hWnd, const int FRAME_COUNT,
+		BindlessDescriptorHeap& descriptorHeap);
 	~ImGuiManager();
 	void NewFrame();
 	void Render(ID3D12GraphicsCommandList* cmdList);
 
 	ImTextureID RegisterTexture(ID3D12Resource* pTextureResource);
+	// 디스크립터는 GPU가 이번 프레임을 끝낸 뒤에 재사용됩니다.
+	void UnregisterTexture(ImTextureID textureId);
 
 private:
 	// Singleton for callback functions without Capture
 	static ImGuiManager* s_instance;
-	Microsoft::WRL::ComPtr<struct ID3D12DescriptorHeap> m_imguiDescHeap;
-	DescriptorHeapAllocator m_imGuiDescHeapAlloc;
 
-	ID3D12Device* m_device = nullptr; // D3D12 ̽
-	const int m_totalHeapSize = 128; //  ũ 
-	UINT m_srvHandleIncrementSize = 0; // SRV ũ ũ
-	int m_currentHeapIndex = 1; //  Ҵ ũ ε(0 ׻ Ʈ̹Ƿ 1 )
+	ID3D12Device* m_device = nullptr; // D3D12 디바이스
+	BindlessDescriptorHeap& m_descriptorHeap; // 엔진 공용 디스크립터 힙 (D3D12App 소유)
 };
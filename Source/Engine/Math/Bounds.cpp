@@ -0,0 +1,135 @@
+#include "Bounds.h"
+
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+	inline XMVECTOR LoadPosition(const XMFLOAT3* positions, size_t index, size_t stride)
+	{
+		const auto* bytes = reinterpret_cast<const unsigned char*>(positions) + index * stride;
+		return XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(bytes));
+	}
+}
+
+MeshBounds Bounds::Compute(const XMFLOAT3* positions, size_t count, size_t stride)
+{
+	MeshBounds result;
+	if (!positions || count == 0) return result;
+
+	// 1. AABB: min/max 리덕션
+	// 누산기를 4개로 나누면 각 XMVectorMin/Max가 서로 기다리지 않고 동시에 실행됩니다.
+	XMVECTOR first = LoadPosition(positions, 0, stride);
+	XMVECTOR minAcc[4] = { first, first, first, first };
+	XMVECTOR maxAcc[4] = { first, first, first, first };
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		for (size_t k = 0; k < 4; ++k)
+		{
+			XMVECTOR p = LoadPosition(positions, i + k, stride);
+			minAcc[k] = XMVectorMin(minAcc[k], p);
+			maxAcc[k] = XMVectorMax(maxAcc[k], p);
+		}
+	}
+	for (; i < count; ++i)
+	{
+		XMVECTOR p = LoadPosition(positions, i, stride);
+		minAcc[0] = XMVectorMin(minAcc[0], p);
+		maxAcc[0] = XMVectorMax(maxAcc[0], p);
+	}
+
+	XMVECTOR minPos = XMVectorMin(XMVectorMin(minAcc[0], minAcc[1]), XMVectorMin(minAcc[2], minAcc[3]));
+	XMVECTOR maxPos = XMVectorMax(XMVectorMax(maxAcc[0], maxAcc[1]), XMVectorMax(maxAcc[2], maxAcc[3]));
+
+	XMVECTOR center = XMVectorScale(XMVectorAdd(minPos, maxPos), 0.5f);
+	XMStoreFloat3(&result.Box.Center, center);
+	XMStoreFloat3(&result.Box.Extents, XMVectorScale(XMVectorSubtract(maxPos, minPos), 0.5f));
+
+	// 2. 스피어: 중심에서 가장 먼 정점까지의 거리 (제곱 거리로 비교)
+	XMVECTOR maxDistSq[4] = { XMVectorZero(), XMVectorZero(), XMVectorZero(), XMVectorZero() };
+	for (i = 0; i + 4 <= count; i += 4)
+	{
+		for (size_t k = 0; k < 4; ++k)
+		{
+			XMVECTOR d = XMVectorSubtract(LoadPosition(positions, i + k, stride), center);
+			maxDistSq[k] = XMVectorMax(maxDistSq[k], XMVector3LengthSq(d));
+		}
+	}
+	for (; i < count; ++i)
+	{
+		XMVECTOR d = XMVectorSubtract(LoadPosition(positions, i, stride), center);
+		maxDistSq[0] = XMVectorMax(maxDistSq[0], XMVector3LengthSq(d));
+	}
+
+	XMVECTOR distSq = XMVectorMax(XMVectorMax(maxDistSq[0], maxDistSq[1]), XMVectorMax(maxDistSq[2], maxDistSq[3]));
+	result.Sphere.Center = result.Box.Center;
+	result.Sphere.Radius = std::sqrt(XMVectorGetX(distSq));
+
+	return result;
+}
+
+MeshBounds Bounds::Merge(const MeshBounds& a, const MeshBounds& b)
+{
+	MeshBounds result;
+
+	// AABB 합집합
+	XMVECTOR aCenter = XMLoadFloat3(&a.Box.Center), aExtents = XMLoadFloat3(&a.Box.Extents);
+	XMVECTOR bCenter = XMLoadFloat3(&b.Box.Center), bExtents = XMLoadFloat3(&b.Box.Extents);
+
+	XMVECTOR minPos = XMVectorMin(XMVectorSubtract(aCenter, aExtents), XMVectorSubtract(bCenter, bExtents));
+	XMVECTOR maxPos = XMVectorMax(XMVectorAdd(aCenter, aExtents), XMVectorAdd(bCenter, bExtents));
+
+	XMVECTOR center = XMVectorScale(XMVectorAdd(minPos, maxPos), 0.5f);
+	XMStoreFloat3(&result.Box.Center, center);
+	XMStoreFloat3(&result.Box.Extents, XMVectorScale(XMVectorSubtract(maxPos, minPos), 0.5f));
+
+	// 합친 AABB 중심에서 두 스피어를 모두 덮는 반지름
+	float radiusA = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&a.Sphere.Center), center))) + a.Sphere.Radius;
+	float radiusB = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&b.Sphere.Center), center))) + b.Sphere.Radius;
+
+	result.Sphere.Center = result.Box.Center;
+	result.Sphere.Radius = (radiusA > radiusB) ? radiusA : radiusB;
+
+	return result;
+}
+
+Aabb Bounds::Transform(const Aabb& box, FXMMATRIX world)
+{
+	// 행 벡터 규약(v * M): 새 반크기 = |M(3x3)|의 각 행에 원래 반크기 성분을 곱해 더한 값
+	Aabb result;
+	XMStoreFloat3(&result.Center, XMVector3TransformCoord(XMLoadFloat3(&box.Center), world));
+
+	XMVECTOR extents = XMVectorMultiply(XMVectorAbs(world.r[0]), XMVectorReplicate(box.Extents.x));
+	extents = XMVectorMultiplyAdd(XMVectorAbs(world.r[1]), XMVectorReplicate(box.Extents.y), extents);
+	extents = XMVectorMultiplyAdd(XMVectorAbs(world.r[2]), XMVectorReplicate(box.Extents.z), extents);
+	XMStoreFloat3(&result.Extents, extents);
+
+	return result;
+}
+
+BoundingSphere Bounds::Transform(const BoundingSphere& sphere, FXMMATRIX world)
+{
+	BoundingSphere result;
+	XMStoreFloat3(&result.Center, XMVector3TransformCoord(XMLoadFloat3(&sphere.Center), world));
+
+	// 각 축 방향 행의 길이가 그 축의 스케일입니다.
+	float scaleX = XMVectorGetX(XMVector3LengthSq(world.r[0]));
+	float scaleY = XMVectorGetX(XMVector3LengthSq(world.r[1]));
+	float scaleZ = XMVectorGetX(XMVector3LengthSq(world.r[2]));
+	float maxScaleSq = scaleX > scaleY ? scaleX : scaleY;
+	maxScaleSq = maxScaleSq > scaleZ ? maxScaleSq : scaleZ;
+
+	result.Radius = sphere.Radius * std::sqrt(maxScaleSq);
+	return result;
+}
+
+MeshBounds Bounds::Transform(const MeshBounds& bounds, FXMMATRIX world)
+{
+	MeshBounds result;
+	result.Box = Transform(bounds.Box, world);
+	result.Sphere = Transform(bounds.Sphere, world);
+	return result;
+}
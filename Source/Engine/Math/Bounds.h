@@ -0,0 +1,45 @@
+// Bounds.h
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstddef>
+
+// 축 정렬 바운딩 박스 (중심 + 반크기)
+struct Aabb
+{
+	DirectX::XMFLOAT3 Center = { 0.0f, 0.0f, 0.0f };
+	DirectX::XMFLOAT3 Extents = { 0.0f, 0.0f, 0.0f };
+};
+
+// 바운딩 스피어
+struct BoundingSphere
+{
+	DirectX::XMFLOAT3 Center = { 0.0f, 0.0f, 0.0f };
+	float Radius = 0.0f;
+};
+
+// 메쉬(또는 서브메쉬)가 함께 들고 다니는 바운딩 볼륨
+struct MeshBounds
+{
+	Aabb Box;
+	BoundingSphere Sphere;
+};
+
+namespace Bounds
+{
+	/*
+	 * 정점 위치 배열로부터 AABB와 바운딩 스피어를 계산합니다.
+	 * - positions: 첫 번째 위치의 주소, stride: 정점 하나의 바이트 크기 (예: sizeof(Vertex))
+	 * - AABB: SIMD min/max 리덕션 (누산기 4개로 의존성 체인을 끊어 병렬 실행)
+	 * - 스피어: AABB 중심 + 가장 먼 정점까지의 거리 (보수적)
+	 */
+	MeshBounds Compute(const DirectX::XMFLOAT3* positions, size_t count, size_t stride);
+
+	// 두 바운딩 볼륨을 모두 감싸는 볼륨 (서브메쉬 -> 메쉬 전체)
+	MeshBounds Merge(const MeshBounds& a, const MeshBounds& b);
+
+	// 월드 행렬로 변환 (AABB는 Arvo 방식으로 다시 감싸고, 스피어 반지름은 최대 스케일로 확대)
+	Aabb Transform(const Aabb& box, DirectX::FXMMATRIX world);
+	BoundingSphere Transform(const BoundingSphere& sphere, DirectX::FXMMATRIX world);
+	MeshBounds Transform(const MeshBounds& bounds, DirectX::FXMMATRIX world);
+}
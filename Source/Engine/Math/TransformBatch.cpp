@@ -0,0 +1,299 @@
+#include "TransformBatch.h"
+
+#include <xmmintrin.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+void TransformStreamBuffer::Resize(size_t count)
+{
+	for (auto& stream : m_streams)
+	{
+		stream.resize(count);
+	}
+	m_count = count;
+}
+
+void TransformStreamBuffer::Set(size_t index, const XMFLOAT3& position,
+	const XMFLOAT4& rotation, const XMFLOAT3& scale)
+{
+	m_streams[PX][index] = position.x;
+	m_streams[PY][index] = position.y;
+	m_streams[PZ][index] = position.z;
+	m_streams[RX][index] = rotation.x;
+	m_streams[RY][index] = rotation.y;
+	m_streams[RZ][index] = rotation.z;
+	m_streams[RW][index] = rotation.w;
+	m_streams[SX][index] = scale.x;
+	m_streams[SY][index] = scale.y;
+	m_streams[SZ][index] = scale.z;
+}
+
+TransformStreams TransformStreamBuffer::GetStreams() const
+{
+	TransformStreams streams;
+	streams.PositionX = m_streams[PX].data();
+	streams.PositionY = m_streams[PY].data();
+	streams.PositionZ = m_streams[PZ].data();
+	streams.RotationX = m_streams[RX].data();
+	streams.RotationY = m_streams[RY].data();
+	streams.RotationZ = m_streams[RZ].data();
+	streams.RotationW = m_streams[RW].data();
+	streams.ScaleX = m_streams[SX].data();
+	streams.ScaleY = m_streams[SY].data();
+	streams.ScaleZ = m_streams[SZ].data();
+	streams.Count = m_count;
+	return streams;
+}
+
+namespace
+{
+	/*
+	 * 쿼터니언 -> 회전 행렬 (XMMatrixRotationQuaternion과 같은 행 벡터 규약)
+	 * r0 = (1 - 2(yy + zz),     2(xy + zw),     2(xz - yw))
+	 * r1 = (    2(xy - zw), 1 - 2(xx + zz),     2(yz + xw))
+	 * r2 = (    2(xz + yw),     2(yz - xw), 1 - 2(xx + yy))
+	 * 각 행에 스케일을 곱하고 마지막 행에 위치를 넣으면 S * R * T가 됩니다.
+	 */
+	void ComposeScalar(const TransformStreams& s, size_t i, float m[4][4])
+	{
+		const float x = s.RotationX[i], y = s.RotationY[i], z = s.RotationZ[i], w = s.RotationW[i];
+		const float xx = x * x, yy = y * y, zz = z * z;
+		const float xy = x * y, xz = x * z, yz = y * z;
+		const float xw = x * w, yw = y * w, zw = z * w;
+
+		const float sx = s.ScaleX[i], sy = s.ScaleY[i], sz = s.ScaleZ[i];
+
+		m[0][0] = (1.0f - 2.0f * (yy + zz)) * sx;
+		m[0][1] = (2.0f * (xy + zw)) * sx;
+		m[0][2] = (2.0f * (xz - yw)) * sx;
+		m[0][3] = 0.0f;
+
+		m[1][0] = (2.0f * (xy - zw)) * sy;
+		m[1][1] = (1.0f - 2.0f * (xx + zz)) * sy;
+		m[1][2] = (2.0f * (yz + xw)) * sy;
+		m[1][3] = 0.0f;
+
+		m[2][0] = (2.0f * (xz + yw)) * sz;
+		m[2][1] = (2.0f * (yz - xw)) * sz;
+		m[2][2] = (1.0f - 2.0f * (xx + yy)) * sz;
+		m[2][3] = 0.0f;
+
+		m[3][0] = s.PositionX[i];
+		m[3][1] = s.PositionY[i];
+		m[3][2] = s.PositionZ[i];
+		m[3][3] = 1.0f;
+	}
+
+	void ComputeRangeScalar(const TransformStreams& streams, size_t begin, size_t end,
+		XMFLOAT4X4* outWorld, const XMFLOAT4X4* viewProj, XMFLOAT4X4* outWvpTransposed)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			float world[4][4];
+			ComposeScalar(streams, i, world);
+
+			if (outWorld)
+			{
+				std::copy(&world[0][0], &world[0][0] + 16, &outWorld[i].m[0][0]);
+			}
+
+			if (viewProj && outWvpTransposed)
+			{
+				// (World * ViewProj)^T : 결과의 [j][r] = sum_k world[r][k] * vp[k][j]
+				for (int r = 0; r < 4; ++r)
+				{
+					for (int j = 0; j < 4; ++j)
+					{
+						float sum = 0.0f;
+						for (int k = 0; k < 4; ++k)
+						{
+							sum += world[r][k] * viewProj->m[k][j];
+						}
+						outWvpTransposed[i].m[j][r] = sum;
+					}
+				}
+			}
+		}
+	}
+
+	// 4개 오브젝트의 같은 위치 성분(a, b, c, d)을 전치하여 각 오브젝트의 한 행으로 저장합니다.
+	inline void StoreRows(__m128 a, __m128 b, __m128 c, __m128 d, XMFLOAT4X4* out, size_t row)
+	{
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+		_mm_storeu_ps(out[0].m[row], a);
+		_mm_storeu_ps(out[1].m[row], b);
+		_mm_storeu_ps(out[2].m[row], c);
+		_mm_storeu_ps(out[3].m[row], d);
+	}
+}
+
+void TransformBatch::ComputeWorldMatricesScalar(const TransformStreams& streams,
+	XMFLOAT4X4* outWorld, const XMFLOAT4X4* viewProj, XMFLOAT4X4* outWvpTransposed)
+{
+	ComputeRangeScalar(streams, 0, streams.Count, outWorld, viewProj, outWvpTransposed);
+}
+
+void TransformBatch::ComputeWorldMatrices(const TransformStreams& streams,
+	XMFLOAT4X4* outWorld, const XMFLOAT4X4* viewProj, XMFLOAT4X4* outWvpTransposed)
+{
+	const bool computeWvp = (viewProj != nullptr && outWvpTransposed != nullptr);
+	const size_t simdCount = streams.Count - (streams.Count % SIMD_WIDTH);
+
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 zero = _mm_setzero_ps();
+
+	// ViewProj의 각 원소를 미리 브로드캐스트해 둡니다. (모든 오브젝트가 공유)
+	__m128 vp[4][4] = {};
+	if (computeWvp)
+	{
+		for (int k = 0; k < 4; ++k)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				vp[k][j] = _mm_set1_ps(viewProj->m[k][j]);
+			}
+		}
+	}
+
+	for (size_t i = 0; i < simdCount; i += SIMD_WIDTH)
+	{
+		// [SoA 로드] 레지스터 하나 = 오브젝트 4개의 같은 성분
+		const __m128 x = _mm_loadu_ps(streams.RotationX + i);
+		const __m128 y = _mm_loadu_ps(streams.RotationY + i);
+		const __m128 z = _mm_loadu_ps(streams.RotationZ + i);
+		const __m128 w = _mm_loadu_ps(streams.RotationW + i);
+
+		const __m128 sx = _mm_loadu_ps(streams.ScaleX + i);
+		const __m128 sy = _mm_loadu_ps(streams.ScaleY + i);
+		const __m128 sz = _mm_loadu_ps(streams.ScaleZ + i);
+
+		const __m128 px = _mm_loadu_ps(streams.PositionX + i);
+		const __m128 py = _mm_loadu_ps(streams.PositionY + i);
+		const __m128 pz = _mm_loadu_ps(streams.PositionZ + i);
+
+		const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+		const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+		const __m128 xw = _mm_mul_ps(x, w), yw = _mm_mul_ps(y, w), zw = _mm_mul_ps(z, w);
+
+		// m[r][c] : 오브젝트 4개의 (r, c) 원소
+		__m128 m[3][3];
+		m[0][0] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+		m[0][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, zw)), sx);
+		m[0][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, yw)), sx);
+
+		m[1][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, zw)), sy);
+		m[1][1] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+		m[1][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, xw)), sy);
+
+		m[2][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, yw)), sz);
+		m[2][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, xw)), sz);
+		m[2][2] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+
+		if (outWorld)
+		{
+			XMFLOAT4X4* out = outWorld + i;
+			StoreRows(m[0][0], m[0][1], m[0][2], zero, out, 0);
+			StoreRows(m[1][0], m[1][1], m[1][2], zero, out, 1);
+			StoreRows(m[2][0], m[2][1], m[2][2], zero, out, 2);
+			StoreRows(px, py, pz, one, out, 3);
+		}
+
+		if (computeWvp)
+		{
+			// WVP[r][j] = sum_k World[r][k] * VP[k][j]
+			// World의 3열은 (0, 0, 0, 1)이므로 행 0~2는 k = 0..2만, 행 3은 VP[3][j]를 더합니다.
+			// 전치 출력이므로 WVP의 '열 j'를 결과의 '행 j'로 저장합니다.
+			XMFLOAT4X4* out = outWvpTransposed + i;
+			for (size_t j = 0; j < 4; ++j)
+			{
+				__m128 r[4];
+				for (size_t row = 0; row < 3; ++row)
+				{
+					r[row] = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(m[row][0], vp[0][j]),
+						_mm_mul_ps(m[row][1], vp[1][j])),
+						_mm_mul_ps(m[row][2], vp[2][j]));
+				}
+				r[3] = _mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(px, vp[0][j]),
+					_mm_mul_ps(py, vp[1][j])),
+					_mm_add_ps(_mm_mul_ps(pz, vp[2][j]), vp[3][j]));
+
+				StoreRows(r[0], r[1], r[2], r[3], out, j);
+			}
+		}
+	}
+
+	// 4개로 나누어 떨어지지 않는 나머지
+	ComputeRangeScalar(streams, simdCount, streams.Count, outWorld, viewProj, outWvpTransposed);
+}
+
+TransformBatch::BenchmarkResult TransformBatch::RunBenchmark(size_t count, uint32_t iterations)
+{
+	BenchmarkResult result;
+	result.Count = count;
+	if (count == 0 || iterations == 0) return result;
+
+	// 재현 가능한 의사 난수 (LCG)
+	uint32_t seed = 12345u;
+	auto random = [&seed](float minValue, float maxValue)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		float t = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+		return minValue + (maxValue - minValue) * t;
+	};
+
+	TransformStreamBuffer buffer;
+	buffer.Resize(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		XMFLOAT3 position(random(-100.0f, 100.0f), random(-100.0f, 100.0f), random(-100.0f, 100.0f));
+		XMFLOAT4 rotation(random(-1.0f, 1.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f), random(-1.0f, 1.0f));
+		XMStoreFloat4(&rotation, XMQuaternionNormalize(XMLoadFloat4(&rotation)));
+		XMFLOAT3 scale(random(0.5f, 2.0f), random(0.5f, 2.0f), random(0.5f, 2.0f));
+		buffer.Set(i, position, rotation, scale);
+	}
+
+	XMFLOAT4X4 viewProj;
+	XMStoreFloat4x4(&viewProj, XMMatrixMultiply(
+		XMMatrixLookAtLH(XMVectorSet(0.0f, 50.0f, -200.0f, 1.0f), XMVectorZero(), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f)),
+		XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f)));
+
+	const TransformStreams streams = buffer.GetStreams();
+	std::vector<XMFLOAT4X4> scalarWorld(count), scalarWvp(count);
+	std::vector<XMFLOAT4X4> simdWorld(count), simdWvp(count);
+
+	using Clock = std::chrono::steady_clock;
+
+	auto start = Clock::now();
+	for (uint32_t n = 0; n < iterations; ++n)
+	{
+		ComputeWorldMatricesScalar(streams, scalarWorld.data(), &viewProj, scalarWvp.data());
+	}
+	result.ScalarMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+	start = Clock::now();
+	for (uint32_t n = 0; n < iterations; ++n)
+	{
+		ComputeWorldMatrices(streams, simdWorld.data(), &viewProj, simdWvp.data());
+	}
+	result.SimdMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (int r = 0; r < 4; ++r)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				result.MaxError = std::max(result.MaxError, std::fabs(scalarWorld[i].m[r][c] - simdWorld[i].m[r][c]));
+				result.MaxError = std::max(result.MaxError, std::fabs(scalarWvp[i].m[r][c] - simdWvp[i].m[r][c]));
+			}
+		}
+	}
+
+	return result;
+}
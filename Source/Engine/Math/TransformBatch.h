@@ -0,0 +1,86 @@
+// TransformBatch.h
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * [TransformStreams]
+ * 위치/회전/스케일을 성분별로 분리한 SoA(Structure of Arrays) 입력입니다.
+ * 같은 성분이 메모리에 연속으로 놓이므로 SIMD 레지스터 하나에
+ * '오브젝트 4개'의 같은 성분을 한 번에 읽을 수 있습니다.
+ */
+struct TransformStreams
+{
+	const float* PositionX = nullptr;
+	const float* PositionY = nullptr;
+	const float* PositionZ = nullptr;
+	const float* RotationX = nullptr; // 쿼터니언
+	const float* RotationY = nullptr;
+	const float* RotationZ = nullptr;
+	const float* RotationW = nullptr;
+	const float* ScaleX = nullptr;
+	const float* ScaleY = nullptr;
+	const float* ScaleZ = nullptr;
+	size_t Count = 0;
+};
+
+/*
+ * [TransformStreamBuffer]
+ * TransformStreams가 가리킬 SoA 배열을 소유하는 버퍼입니다.
+ * 매 프레임 Resize() 후 Set()으로 채워서 사용합니다. (용량은 유지되므로 재할당 없음)
+ */
+class TransformStreamBuffer
+{
+public:
+	void Resize(size_t count);
+	void Set(size_t index, const DirectX::XMFLOAT3& position,
+		const DirectX::XMFLOAT4& rotation, const DirectX::XMFLOAT3& scale);
+
+	size_t GetCount() const { return m_count; }
+	TransformStreams GetStreams() const;
+
+private:
+	enum Stream { PX, PY, PZ, RX, RY, RZ, RW, SX, SY, SZ, STREAM_COUNT };
+
+	std::vector<float> m_streams[STREAM_COUNT];
+	size_t m_count = 0;
+};
+
+namespace TransformBatch
+{
+	// SIMD 한 번에 처리하는 오브젝트 수 (SSE)
+	constexpr size_t SIMD_WIDTH = 4;
+
+	/*
+	 * N개의 월드 행렬(S * R * T)을 한 번에 계산합니다.
+	 * - outWorld: 월드 행렬 출력 (nullptr이면 생략)
+	 * - viewProj / outWvpTransposed: 함께 주면 (World * ViewProj)^T 를 출력합니다.
+	 *   (HLSL 상수 버퍼에 바로 복사할 수 있는 전치 형태)
+	 * 4개 단위로 SIMD 처리하고, 남는 오브젝트는 스칼라 경로로 처리합니다.
+	 */
+	void ComputeWorldMatrices(const TransformStreams& streams,
+		DirectX::XMFLOAT4X4* outWorld,
+		const DirectX::XMFLOAT4X4* viewProj = nullptr,
+		DirectX::XMFLOAT4X4* outWvpTransposed = nullptr);
+
+	// 스칼라 참조 구현 (결과 검증 및 성능 비교용)
+	void ComputeWorldMatricesScalar(const TransformStreams& streams,
+		DirectX::XMFLOAT4X4* outWorld,
+		const DirectX::XMFLOAT4X4* viewProj = nullptr,
+		DirectX::XMFLOAT4X4* outWvpTransposed = nullptr);
+
+	// 마이크로 벤치마크 결과
+	struct BenchmarkResult
+	{
+		size_t Count = 0;
+		double ScalarMs = 0.0;  // 반복 1회당 평균 (ms)
+		double SimdMs = 0.0;    // 반복 1회당 평균 (ms)
+		float MaxError = 0.0f;  // 스칼라 대비 최대 오차
+	};
+
+	// 임의의 Transform count개로 스칼라/SIMD 경로를 비교합니다. (World + WVP 모두 계산)
+	BenchmarkResult RunBenchmark(size_t count, uint32_t iterations);
+}
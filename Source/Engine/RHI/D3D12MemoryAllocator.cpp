@@ -0,0 +1,255 @@
+// D3D12MemoryAllocator.cpp
+#include "RHI/D3D12MemoryAllocator.h"
+
+#include "D3DX12/d3dx12.h"
+#include "Utils/Utils.h" // ThrowIfFailed
+
+#include <algorithm>
+
+using Microsoft::WRL::ComPtr;
+
+namespace
+{
+	constexpr D3D12_HEAP_TYPE POOL_HEAP_TYPES[] = { D3D12_HEAP_TYPE_DEFAULT, D3D12_HEAP_TYPE_UPLOAD, D3D12_HEAP_TYPE_READBACK };
+
+	// 힙 안의 오프셋 관리 단위 (작은 텍스처의 배치 정렬)
+	constexpr uint64_t PLACEMENT_GRANULARITY = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+
+	D3D12_HEAP_FLAGS ToHeapFlags(D3D12ResourceCategory category)
+	{
+		switch (category)
+		{
+		case D3D12ResourceCategory::Texture:             return D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+		case D3D12ResourceCategory::RenderTargetOrDepth: return D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+		default:                                         return D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+		}
+	}
+}
+
+D3D12MemoryAllocator::D3D12MemoryAllocator(ID3D12Device* device, uint64_t heapSize)
+	: m_device(device)
+{
+	for (uint32_t typeIndex = 0; typeIndex < HEAP_TYPE_COUNT; ++typeIndex)
+	{
+		for (uint32_t category = 0; category < static_cast<uint32_t>(D3D12ResourceCategory::Count); ++category)
+		{
+			Pool& pool = m_pools[GetPoolIndex(POOL_HEAP_TYPES[typeIndex], static_cast<D3D12ResourceCategory>(category))];
+			pool.HeapType = POOL_HEAP_TYPES[typeIndex];
+			pool.Category = static_cast<D3D12ResourceCategory>(category);
+			pool.HeapSize = (pool.HeapType == D3D12_HEAP_TYPE_DEFAULT) ? heapSize : heapSize / 4;
+		}
+	}
+}
+
+D3D12MemoryAllocator::~D3D12MemoryAllocator() = default;
+
+uint32_t D3D12MemoryAllocator::GetPoolIndex(D3D12_HEAP_TYPE heapType, D3D12ResourceCategory category)
+{
+	uint32_t typeIndex = 0;
+	if (heapType == D3D12_HEAP_TYPE_UPLOAD) typeIndex = 1;
+	else if (heapType == D3D12_HEAP_TYPE_READBACK) typeIndex = 2;
+
+	return typeIndex * static_cast<uint32_t>(D3D12ResourceCategory::Count) + static_cast<uint32_t>(category);
+}
+
+D3D12ResourceCategory D3D12MemoryAllocator::GetCategory(const D3D12_RESOURCE_DESC& desc)
+{
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) return D3D12ResourceCategory::Buffer;
+	if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
+	{
+		return D3D12ResourceCategory::RenderTargetOrDepth;
+	}
+	return D3D12ResourceCategory::Texture;
+}
+
+ComPtr<ID3D12Resource> D3D12MemoryAllocator::CreateResource(D3D12_HEAP_TYPE heapType, const D3D12_RESOURCE_DESC& desc,
+	D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* optimizedClearValue, D3D12MemoryAllocation& outAllocation)
+{
+	const D3D12ResourceCategory category = GetCategory(desc);
+	D3D12_RESOURCE_DESC placedDesc = desc;
+
+	// 렌더 타겟/깊이가 아닌 작은 텍스처는 4KB 정렬을 먼저 시도합니다. (안 되면 기본 64KB)
+	D3D12_RESOURCE_ALLOCATION_INFO info = {};
+	if (category == D3D12ResourceCategory::Texture && placedDesc.SampleDesc.Count <= 1)
+	{
+		placedDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+		info = m_device->GetResourceAllocationInfo(0, 1, &placedDesc);
+		if (info.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT)
+		{
+			placedDesc.Alignment = 0;
+			info = m_device->GetResourceAllocationInfo(0, 1, &placedDesc);
+		}
+	}
+	else
+	{
+		info = m_device->GetResourceAllocationInfo(0, 1, &placedDesc);
+	}
+
+	outAllocation = {};
+	outAllocation.Pool = GetPoolIndex(heapType, category);
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Pool& pool = m_pools[outAllocation.Pool];
+
+		const bool placeable = info.SizeInBytes != UINT64_MAX
+			&& info.Alignment <= D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT
+			&& info.SizeInBytes <= pool.HeapSize / 2;
+
+		if (placeable)
+		{
+			// 기존 힙에서 먼저 찾고, 없으면 빈 자리(해제된 힙)나 끝에 새 힙을 만듭니다.
+			uint32_t heapIndex = 0;
+			for (; heapIndex < pool.Heaps.size(); ++heapIndex)
+			{
+				Heap& heap = pool.Heaps[heapIndex];
+				if (!heap.Allocator) continue;
+
+				outAllocation.Range = heap.Allocator->Allocate(info.SizeInBytes, info.Alignment);
+				if (outAllocation.Range.IsValid()) break;
+			}
+
+			if (!outAllocation.Range.IsValid())
+			{
+				heapIndex = 0;
+				while (heapIndex < pool.Heaps.size() && pool.Heaps[heapIndex].Allocator) ++heapIndex;
+				if (heapIndex == pool.Heaps.size()) pool.Heaps.emplace_back();
+
+				const CD3DX12_HEAP_DESC heapDesc(pool.HeapSize, pool.HeapType, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, ToHeapFlags(pool.Category));
+				Heap& heap = pool.Heaps[heapIndex];
+				ThrowIfFailed(m_device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap.Native)));
+				heap.Allocator = std::make_unique<TlsfAllocator>(pool.HeapSize, PLACEMENT_GRANULARITY);
+
+				outAllocation.Range = heap.Allocator->Allocate(info.SizeInBytes, info.Alignment);
+			}
+
+			outAllocation.Heap = heapIndex;
+
+			ComPtr<ID3D12Resource> resource;
+			const HRESULT hr = m_device->CreatePlacedResource(pool.Heaps[heapIndex].Native.Get(), outAllocation.Range.Offset,
+				&placedDesc, initialState, optimizedClearValue, IID_PPV_ARGS(&resource));
+			if (FAILED(hr))
+			{
+				pool.Heaps[heapIndex].Allocator->Free(outAllocation.Range);
+				ThrowIfFailed(hr);
+			}
+			return resource;
+		}
+
+		++m_committedCount;
+		m_committedBytes += info.SizeInBytes;
+	}
+
+	// 힙에 넣기엔 큰 리소스: 따로 커밋합니다.
+	outAllocation.CommittedSize = info.SizeInBytes;
+
+	const CD3DX12_HEAP_PROPERTIES heapProps(heapType);
+	ComPtr<ID3D12Resource> resource;
+	const HRESULT hr = m_device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+		initialState, optimizedClearValue, IID_PPV_ARGS(&resource));
+	if (FAILED(hr))
+	{
+		Free(outAllocation);
+		ThrowIfFailed(hr);
+	}
+	return resource;
+}
+
+void D3D12MemoryAllocator::Free(const D3D12MemoryAllocation& allocation)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (!allocation.IsPlaced())
+	{
+		if (allocation.CommittedSize > 0)
+		{
+			--m_committedCount;
+			m_committedBytes -= allocation.CommittedSize;
+		}
+		return;
+	}
+
+	Heap& heap = m_pools[allocation.Pool].Heaps[allocation.Heap];
+	heap.Allocator->Free(allocation.Range);
+}
+
+std::vector<D3D12MemoryAllocator::DefragmentationMove> D3D12MemoryAllocator::PlanDefragmentation(uint64_t maxBytesPerHeap)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::vector<DefragmentationMove> moves;
+	for (uint32_t poolIndex = 0; poolIndex < std::size(m_pools); ++poolIndex)
+	{
+		Pool& pool = m_pools[poolIndex];
+		for (uint32_t heapIndex = 0; heapIndex < pool.Heaps.size(); ++heapIndex)
+		{
+			Heap& heap = pool.Heaps[heapIndex];
+			if (!heap.Allocator) continue;
+
+			for (const TlsfAllocator::Move& planned : heap.Allocator->PlanDefragmentation(maxBytesPerHeap))
+			{
+				DefragmentationMove move;
+				move.Heap = heap.Native.Get();
+				move.Source.Pool = move.Destination.Pool = poolIndex;
+				move.Source.Heap = move.Destination.Heap = heapIndex;
+				move.Source.Range = planned.Source;
+				move.Destination.Range = planned.Destination;
+				moves.push_back(move);
+			}
+		}
+	}
+	return moves;
+}
+
+void D3D12MemoryAllocator::ReleaseEmptyHeaps()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (Pool& pool : m_pools)
+	{
+		bool keptOne = false;
+		for (Heap& heap : pool.Heaps)
+		{
+			if (!heap.Allocator) continue;
+			if (!heap.Allocator->IsEmpty() || !keptOne)
+			{
+				keptOne = true;
+				continue;
+			}
+
+			heap.Native.Reset();
+			heap.Allocator.reset();
+		}
+	}
+}
+
+D3D12MemoryAllocator::Stats D3D12MemoryAllocator::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Stats stats;
+	stats.CommittedCount = m_committedCount;
+	stats.CommittedBytes = m_committedBytes;
+
+	for (const Pool& pool : m_pools)
+	{
+		PoolStats poolStats;
+		poolStats.HeapType = pool.HeapType;
+		poolStats.Category = pool.Category;
+
+		for (const Heap& heap : pool.Heaps)
+		{
+			if (!heap.Allocator) continue;
+
+			const TlsfAllocator::Stats heapStats = heap.Allocator->GetStats();
+			++poolStats.HeapCount;
+			poolStats.ReservedBytes += heapStats.Capacity;
+			poolStats.UsedBytes += heapStats.UsedBytes;
+			poolStats.AllocationCount += heapStats.AllocationCount;
+			poolStats.Fragmentation = (std::max)(poolStats.Fragmentation, heapStats.GetFragmentation());
+		}
+
+		if (poolStats.HeapCount > 0) stats.Pools.push_back(poolStats);
+	}
+	return stats;
+}
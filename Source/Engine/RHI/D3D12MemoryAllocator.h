@@ -0,0 +1,125 @@
+// D3D12MemoryAllocator.h
+#pragma once
+
+#include <windows.h>
+#include <wrl.h>
+#include <d3d12.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Utils/TlsfAllocator.h"
+
+// 배치 리소스를 섞을 수 없는 힙 분류 (리소스 힙 티어 1 기준)
+enum class D3D12ResourceCategory : uint8_t
+{
+	Buffer,
+	Texture,             // 렌더 타겟/깊이가 아닌 텍스처
+	RenderTargetOrDepth,
+	Count,
+};
+
+// D3D12MemoryAllocator가 나눠 준 메모리 하나
+struct D3D12MemoryAllocation
+{
+	uint32_t Pool = 0;
+	uint32_t Heap = 0;
+	TlsfAllocator::Allocation Range;   // 배치 리소스의 힙 안 구간
+	uint64_t CommittedSize = 0;        // 커밋된 리소스로 만들었으면 그 크기
+
+	bool IsPlaced() const { return Range.IsValid(); }
+};
+
+/*
+ * [D3D12MemoryAllocator]
+ * 리소스마다 CreateCommittedResource로 힙을 따로 만드는 대신,
+ * 힙 종류(Default/Upload/Readback) x 리소스 분류별로 큰 ID3D12Heap을 잡아 두고 배치 리소스(Placed Resource)로 잘라 씁니다.
+ * - 힙 안의 오프셋 관리는 TlsfAllocator가 하므로 할당/해제가 O(1)이고, 해제된 구간은 이웃과 바로 합쳐집니다.
+ * - 힙이 모자라면 같은 크기의 힙을 하나 더 만듭니다.
+ * - 힙 크기의 절반을 넘는 리소스나 특수 정렬(MSAA)이 필요한 리소스는 그냥 커밋된 리소스로 만듭니다.
+ *
+ * 해제(Free)는 GPU가 그 리소스를 다 쓴 뒤에 해야 합니다. (D3D12App::RetireResource를 거치면 됨)
+ * 조각 모음 훅: PlanDefragmentation이 옮길 목적지를 잡아 주면, 소유자가 새 위치에 리소스를 만들고 복사한 뒤 원래 할당을 Free합니다.
+ * 내부에서 잠그므로 여러 스레드에서 불러도 됩니다.
+ */
+class D3D12MemoryAllocator
+{
+public:
+	static constexpr uint64_t DEFAULT_HEAP_SIZE = 64ull * 1024 * 1024;
+
+	struct PoolStats
+	{
+		D3D12_HEAP_TYPE HeapType = D3D12_HEAP_TYPE_DEFAULT;
+		D3D12ResourceCategory Category = D3D12ResourceCategory::Buffer;
+		uint32_t HeapCount = 0;
+		uint64_t ReservedBytes = 0; // 잡아 둔 힙 크기의 합
+		uint64_t UsedBytes = 0;     // 그중 리소스가 차지한 바이트 (배치 정렬 포함)
+		uint32_t AllocationCount = 0;
+		float Fragmentation = 0.0f; // 힙 중 가장 조각난 값 (TlsfAllocator::Stats::GetFragmentation)
+	};
+
+	struct Stats
+	{
+		std::vector<PoolStats> Pools; // 힙을 하나라도 가진 풀만
+		uint32_t CommittedCount = 0;  // 크기 때문에 따로 만든 커밋된 리소스 수
+		uint64_t CommittedBytes = 0;
+	};
+
+	// 조각 모음으로 옮길 리소스 하나 (같은 힙 안에서 앞쪽으로)
+	struct DefragmentationMove
+	{
+		ID3D12Heap* Heap = nullptr;
+		D3D12MemoryAllocation Source;
+		D3D12MemoryAllocation Destination;
+	};
+
+	// heapSize: Default 힙 하나의 크기. CPU에서 보이는 Upload/Readback 힙은 그 1/4로 잡습니다.
+	explicit D3D12MemoryAllocator(ID3D12Device* device, uint64_t heapSize = DEFAULT_HEAP_SIZE);
+	~D3D12MemoryAllocator();
+
+	D3D12MemoryAllocator(const D3D12MemoryAllocator&) = delete;
+	D3D12MemoryAllocator& operator=(const D3D12MemoryAllocator&) = delete;
+
+	// 가능하면 배치 리소스로, 아니면 커밋된 리소스로 만듭니다. outAllocation은 해제할 때 Free에 넘깁니다.
+	Microsoft::WRL::ComPtr<ID3D12Resource> CreateResource(D3D12_HEAP_TYPE heapType, const D3D12_RESOURCE_DESC& desc,
+		D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* optimizedClearValue, D3D12MemoryAllocation& outAllocation);
+
+	// 리소스를 먼저 해제한 뒤 부르세요. 커밋된 리소스의 할당이면 통계만 갱신합니다.
+	void Free(const D3D12MemoryAllocation& allocation);
+
+	// 힙마다 maxBytesPerHeap까지 옮길 목적지를 잡습니다. (목적지는 이미 할당된 상태)
+	std::vector<DefragmentationMove> PlanDefragmentation(uint64_t maxBytesPerHeap);
+
+	// 풀마다 첫 힙은 남기고, 리소스가 하나도 없는 힙을 OS에 돌려줍니다.
+	void ReleaseEmptyHeaps();
+
+	Stats GetStats() const;
+
+private:
+	struct Heap
+	{
+		Microsoft::WRL::ComPtr<ID3D12Heap> Native;
+		std::unique_ptr<TlsfAllocator> Allocator; // 해제된 힙이면 nullptr (인덱스는 유지)
+	};
+
+	struct Pool
+	{
+		D3D12_HEAP_TYPE HeapType = D3D12_HEAP_TYPE_DEFAULT;
+		D3D12ResourceCategory Category = D3D12ResourceCategory::Buffer;
+		uint64_t HeapSize = 0;
+		std::vector<Heap> Heaps;
+	};
+
+	static constexpr uint32_t HEAP_TYPE_COUNT = 3; // Default, Upload, Readback
+
+	static uint32_t GetPoolIndex(D3D12_HEAP_TYPE heapType, D3D12ResourceCategory category);
+	static D3D12ResourceCategory GetCategory(const D3D12_RESOURCE_DESC& desc);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> m_device;
+	Pool m_pools[HEAP_TYPE_COUNT * static_cast<uint32_t>(D3D12ResourceCategory::Count)];
+
+	uint32_t m_committedCount = 0;
+	uint64_t m_committedBytes = 0;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,540 @@
+#include "D3D12RHI.h"
+
+#include <fstream>
+#include <vector>
+
+#include "RHI/PipelineCache.h" // RHIPipelineKey
+#include "Utils/Utils.h" // ThrowIfFailed
+#include "D3DX12/d3dx12.h"
+
+using Microsoft::WRL::ComPtr;
+
+DXGI_FORMAT D3D12RHI::ToDxgiFormat(RHIFormat format)
+{
+	switch (format)
+	{
+	case RHIFormat::R8G8B8A8_UNorm:      return DXGI_FORMAT_R8G8B8A8_UNORM;
+	case RHIFormat::R8G8B8A8_UNorm_sRGB: return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+	case RHIFormat::R16_UInt:            return DXGI_FORMAT_R16_UINT;
+	case RHIFormat::R32_UInt:            return DXGI_FORMAT_R32_UINT;
+	case RHIFormat::R32_Float:           return DXGI_FORMAT_R32_FLOAT;
+	case RHIFormat::R32G32_Float:        return DXGI_FORMAT_R32G32_FLOAT;
+	case RHIFormat::R32G32B32_Float:     return DXGI_FORMAT_R32G32B32_FLOAT;
+	case RHIFormat::R32G32B32A32_Float:  return DXGI_FORMAT_R32G32B32A32_FLOAT;
+	case RHIFormat::D32_Float:           return DXGI_FORMAT_D32_FLOAT;
+	case RHIFormat::D24_UNorm_S8_UInt:   return DXGI_FORMAT_D24_UNORM_S8_UINT;
+	default:                             return DXGI_FORMAT_UNKNOWN;
+	}
+}
+
+D3D12_RESOURCE_STATES D3D12RHI::ToResourceState(RHIResourceState state)
+{
+	switch (state)
+	{
+	case RHIResourceState::VertexAndConstantBuffer: return D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+	case RHIResourceState::IndexBuffer:             return D3D12_RESOURCE_STATE_INDEX_BUFFER;
+	case RHIResourceState::RenderTarget:            return D3D12_RESOURCE_STATE_RENDER_TARGET;
+	case RHIResourceState::DepthWrite:              return D3D12_RESOURCE_STATE_DEPTH_WRITE;
+	case RHIResourceState::PixelShaderResource:     return D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+	case RHIResourceState::CopySource:              return D3D12_RESOURCE_STATE_COPY_SOURCE;
+	case RHIResourceState::CopyDest:                return D3D12_RESOURCE_STATE_COPY_DEST;
+	case RHIResourceState::GenericRead:             return D3D12_RESOURCE_STATE_GENERIC_READ;
+	case RHIResourceState::Present:                 return D3D12_RESOURCE_STATE_PRESENT;
+	default:                                        return D3D12_RESOURCE_STATE_COMMON;
+	}
+}
+
+D3D12_COMMAND_LIST_TYPE D3D12RHI::ToCommandListType(RHIQueueType type)
+{
+	switch (type)
+	{
+	case RHIQueueType::Compute: return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+	case RHIQueueType::Copy:    return D3D12_COMMAND_LIST_TYPE_COPY;
+	default:                    return D3D12_COMMAND_LIST_TYPE_DIRECT;
+	}
+}
+
+D3D12_PRIMITIVE_TOPOLOGY D3D12RHI::ToPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	switch (topology)
+	{
+	case RHIPrimitiveTopology::TriangleStrip: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+	case RHIPrimitiveTopology::LineList:      return D3D_PRIMITIVE_TOPOLOGY_LINELIST;
+	case RHIPrimitiveTopology::PointList:     return D3D_PRIMITIVE_TOPOLOGY_POINTLIST;
+	default:                                  return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	}
+}
+
+namespace
+{
+	D3D12_PRIMITIVE_TOPOLOGY_TYPE ToTopologyType(RHIPrimitiveTopology topology)
+	{
+		switch (topology)
+		{
+		case RHIPrimitiveTopology::LineList:  return D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE;
+		case RHIPrimitiveTopology::PointList: return D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT;
+		default:                              return D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+		}
+	}
+
+	D3D12_CULL_MODE ToCullMode(RHICullMode mode)
+	{
+		switch (mode)
+		{
+		case RHICullMode::None:  return D3D12_CULL_MODE_NONE;
+		case RHICullMode::Front: return D3D12_CULL_MODE_FRONT;
+		default:                 return D3D12_CULL_MODE_BACK;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+// 리소스
+// ---------------------------------------------------------------------------
+
+D3D12RHIBuffer::D3D12RHIBuffer(const RHIBufferDesc& desc, ComPtr<ID3D12Resource> resource,
+	D3D12MemoryAllocator* allocator, const D3D12MemoryAllocation& allocation)
+	: RHIBuffer(desc)
+	, m_resource(std::move(resource))
+	, m_allocator(allocator)
+	, m_allocation(allocation)
+{
+}
+
+D3D12RHIBuffer::~D3D12RHIBuffer()
+{
+	// 리소스를 먼저 놓고 나서 힙 구간을 돌려줍니다.
+	m_resource.Reset();
+	if (m_allocator) m_allocator->Free(m_allocation);
+}
+
+void* D3D12RHIBuffer::Map()
+{
+	if (m_desc.HeapType == RHIHeapType::Default) return nullptr;
+
+	// 업로드 힙은 CPU가 읽지 않으므로 읽기 범위를 비워 둡니다.
+	const D3D12_RANGE noRead = { 0, 0 };
+	void* data = nullptr;
+	ThrowIfFailed(m_resource->Map(0, (m_desc.HeapType == RHIHeapType::Upload) ? &noRead : nullptr, &data));
+	return data;
+}
+
+void D3D12RHIBuffer::Unmap()
+{
+	if (m_desc.HeapType == RHIHeapType::Default) return;
+
+	// 리드백 힙은 CPU가 쓰지 않았으므로 쓰기 범위를 비워 둡니다.
+	const D3D12_RANGE noWrite = { 0, 0 };
+	m_resource->Unmap(0, (m_desc.HeapType == RHIHeapType::Readback) ? &noWrite : nullptr);
+}
+
+D3D12RHITexture::D3D12RHITexture(const RHITextureDesc& desc, ComPtr<ID3D12Resource> resource,
+	D3D12MemoryAllocator* allocator, const D3D12MemoryAllocation& allocation)
+	: RHITexture(desc)
+	, m_resource(std::move(resource))
+	, m_allocator(allocator)
+	, m_allocation(allocation)
+{
+}
+
+D3D12RHITexture::~D3D12RHITexture()
+{
+	m_resource.Reset();
+	if (m_allocator) m_allocator->Free(m_allocation);
+}
+
+D3D12RHIFence::D3D12RHIFence(ID3D12Device* device, uint64_t initialValue)
+{
+	ThrowIfFailed(device->CreateFence(initialValue, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)));
+	m_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+}
+
+D3D12RHIFence::~D3D12RHIFence()
+{
+	if (m_event) CloseHandle(m_event);
+}
+
+void D3D12RHIFence::Wait(uint64_t value)
+{
+	if (m_fence->GetCompletedValue() >= value) return;
+
+	ThrowIfFailed(m_fence->SetEventOnCompletion(value, m_event));
+	WaitForSingleObjectEx(m_event, INFINITE, FALSE);
+}
+
+// ---------------------------------------------------------------------------
+// 커맨드 리스트 / 큐
+// ---------------------------------------------------------------------------
+
+D3D12RHICommandList::D3D12RHICommandList(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type)
+{
+	ThrowIfFailed(device->CreateCommandAllocator(type, IID_PPV_ARGS(&m_allocator)));
+	ThrowIfFailed(device->CreateCommandList(0, type, m_allocator.Get(), nullptr, IID_PPV_ARGS(&m_commandList)));
+	m_commandList->Close(); // 첫 Reset()부터 기록합니다.
+}
+
+D3D12RHICommandList::D3D12RHICommandList(ID3D12GraphicsCommandList* externalList)
+	: m_commandList(externalList)
+{
+}
+
+void D3D12RHICommandList::Reset()
+{
+	if (!m_allocator) return;
+
+	ThrowIfFailed(m_allocator->Reset());
+	ThrowIfFailed(m_commandList->Reset(m_allocator.Get(), nullptr));
+}
+
+void D3D12RHICommandList::Close()
+{
+	if (!m_allocator) return;
+
+	ThrowIfFailed(m_commandList->Close());
+}
+
+void D3D12RHICommandList::SetPipeline(const RHIPipeline* pipeline)
+{
+	const D3D12RHIPipeline* d3dPipeline = static_cast<const D3D12RHIPipeline*>(pipeline);
+	m_commandList->SetGraphicsRootSignature(d3dPipeline->GetRootSignature());
+	m_commandList->SetPipelineState(d3dPipeline->GetPipelineState());
+	m_rootShaderResourceBase = d3dPipeline->GetConstantBufferCount();
+}
+
+void D3D12RHICommandList::SetPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	m_commandList->IASetPrimitiveTopology(D3D12RHI::ToPrimitiveTopology(topology));
+}
+
+void D3D12RHICommandList::SetVertexBuffer(uint32_t slot, const RHIBuffer* buffer, uint32_t stride, uint64_t offset)
+{
+	D3D12_VERTEX_BUFFER_VIEW view = {};
+	view.BufferLocation = buffer->GetGPUAddress() + offset;
+	view.SizeInBytes = static_cast<UINT>(buffer->GetDesc().Size - offset);
+	view.StrideInBytes = stride;
+	m_commandList->IASetVertexBuffers(slot, 1, &view);
+}
+
+void D3D12RHICommandList::SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format, uint64_t offset)
+{
+	D3D12_INDEX_BUFFER_VIEW view = {};
+	view.BufferLocation = buffer->GetGPUAddress() + offset;
+	view.SizeInBytes = static_cast<UINT>(buffer->GetDesc().Size - offset);
+	view.Format = D3D12RHI::ToDxgiFormat(format);
+	m_commandList->IASetIndexBuffer(&view);
+}
+
+void D3D12RHICommandList::SetConstantBuffer(uint32_t slot, uint64_t gpuAddress)
+{
+	m_commandList->SetGraphicsRootConstantBufferView(slot, gpuAddress);
+}
+
+void D3D12RHICommandList::SetShaderResource(uint32_t slot, uint64_t gpuAddress)
+{
+	m_commandList->SetGraphicsRootShaderResourceView(m_rootShaderResourceBase + slot, gpuAddress);
+}
+
+void D3D12RHICommandList::SetViewport(const RHIViewport& viewport)
+{
+	const D3D12_VIEWPORT d3dViewport = { viewport.X, viewport.Y, viewport.Width, viewport.Height, viewport.MinDepth, viewport.MaxDepth };
+	m_commandList->RSSetViewports(1, &d3dViewport);
+}
+
+void D3D12RHICommandList::SetScissorRect(const RHIRect& rect)
+{
+	const D3D12_RECT d3dRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
+	m_commandList->RSSetScissorRects(1, &d3dRect);
+}
+
+void D3D12RHICommandList::DrawIndexed(uint32_t indexCount, uint32_t instanceCount,
+	uint32_t startIndex, int32_t baseVertex, uint32_t startInstance)
+{
+	m_commandList->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+}
+
+void D3D12RHICommandList::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance)
+{
+	m_commandList->DrawInstanced(vertexCount, instanceCount, startVertex, startInstance);
+}
+
+void D3D12RHICommandList::ResourceBarrier(const RHIResource* resource, RHIResourceState before, RHIResourceState after)
+{
+	const CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
+		static_cast<ID3D12Resource*>(resource->GetNativeHandle()),
+		D3D12RHI::ToResourceState(before),
+		D3D12RHI::ToResourceState(after));
+	m_commandList->ResourceBarrier(1, &barrier);
+}
+
+void D3D12RHICommandList::CopyBuffer(const RHIBuffer* destination, uint64_t destinationOffset,
+	const RHIBuffer* source, uint64_t sourceOffset, uint64_t size)
+{
+	m_commandList->CopyBufferRegion(
+		static_cast<ID3D12Resource*>(destination->GetNativeHandle()), destinationOffset,
+		static_cast<ID3D12Resource*>(source->GetNativeHandle()), sourceOffset, size);
+}
+
+void D3D12RHICommandQueue::Submit(RHICommandList* const* commandLists, uint32_t count)
+{
+	std::vector<ID3D12CommandList*> nativeLists(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		nativeLists[i] = static_cast<D3D12RHICommandList*>(commandLists[i])->GetNative();
+	}
+	m_queue->ExecuteCommandLists(count, nativeLists.data());
+}
+
+void D3D12RHICommandQueue::Signal(RHIFence& fence, uint64_t value)
+{
+	ThrowIfFailed(m_queue->Signal(static_cast<D3D12RHIFence&>(fence).GetNative(), value));
+}
+
+void D3D12RHICommandQueue::WaitForFence(RHIFence& fence, uint64_t value)
+{
+	ThrowIfFailed(m_queue->Wait(static_cast<D3D12RHIFence&>(fence).GetNative(), value));
+}
+
+// ---------------------------------------------------------------------------
+// 디바이스
+// ---------------------------------------------------------------------------
+
+D3D12RHIDevice::D3D12RHIDevice(ID3D12Device* device, ID3D12CommandQueue* directQueue)
+	: m_device(device), m_memoryAllocator(device)
+{
+	m_queues[static_cast<size_t>(RHIQueueType::Direct)] = std::make_unique<D3D12RHICommandQueue>(directQueue);
+}
+
+std::unique_ptr<RHIBuffer> D3D12RHIDevice::CreateBuffer(const RHIBufferDesc& desc)
+{
+	D3D12_HEAP_TYPE heapType = D3D12_HEAP_TYPE_DEFAULT;
+	D3D12_RESOURCE_STATES initialState = D3D12RHI::ToResourceState(desc.InitialState);
+
+	// 업로드/리드백 힙은 정해진 상태로만 만들 수 있습니다.
+	if (desc.HeapType == RHIHeapType::Upload)
+	{
+		heapType = D3D12_HEAP_TYPE_UPLOAD;
+		initialState = D3D12_RESOURCE_STATE_GENERIC_READ;
+	}
+	else if (desc.HeapType == RHIHeapType::Readback)
+	{
+		heapType = D3D12_HEAP_TYPE_READBACK;
+		initialState = D3D12_RESOURCE_STATE_COPY_DEST;
+	}
+
+	const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(desc.Size);
+
+	D3D12MemoryAllocation allocation;
+	ComPtr<ID3D12Resource> resource = m_memoryAllocator.CreateResource(heapType, bufferDesc, initialState, nullptr, allocation);
+
+	return std::make_unique<D3D12RHIBuffer>(desc, std::move(resource), &m_memoryAllocator, allocation);
+}
+
+std::unique_ptr<RHITexture> D3D12RHIDevice::CreateTexture(const RHITextureDesc& desc)
+{
+	const DXGI_FORMAT format = D3D12RHI::ToDxgiFormat(desc.Format);
+
+	D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
+	if (desc.Usage & RHI_TEXTURE_USAGE_RENDER_TARGET) flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+	if (desc.Usage & RHI_TEXTURE_USAGE_DEPTH_STENCIL)
+	{
+		flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+		if (!(desc.Usage & RHI_TEXTURE_USAGE_SHADER_RESOURCE)) flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
+	}
+
+	const CD3DX12_RESOURCE_DESC textureDesc = CD3DX12_RESOURCE_DESC::Tex2D(format, desc.Width, desc.Height, 1, 1, 1, 0, flags);
+
+	// 렌더 타겟/깊이 버퍼는 최적 클리어 값을 지정해야 빠른 클리어가 됩니다.
+	D3D12_CLEAR_VALUE clearValue = {};
+	clearValue.Format = format;
+	const D3D12_CLEAR_VALUE* optimizedClear = nullptr;
+	if (desc.Usage & RHI_TEXTURE_USAGE_DEPTH_STENCIL)
+	{
+		clearValue.DepthStencil.Depth = desc.ClearDepth;
+		optimizedClear = &clearValue;
+	}
+	else if (desc.Usage & RHI_TEXTURE_USAGE_RENDER_TARGET)
+	{
+		for (int i = 0; i < 4; ++i) clearValue.Color[i] = desc.ClearColor[i];
+		optimizedClear = &clearValue;
+	}
+
+	D3D12MemoryAllocation allocation;
+	ComPtr<ID3D12Resource> resource = m_memoryAllocator.CreateResource(D3D12_HEAP_TYPE_DEFAULT, textureDesc,
+		D3D12RHI::ToResourceState(desc.InitialState), optimizedClear, allocation);
+
+	return std::make_unique<D3D12RHITexture>(desc, std::move(resource), &m_memoryAllocator, allocation);
+}
+
+std::unique_ptr<RHIPipeline> D3D12RHIDevice::CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc)
+{
+	// 루트 시그니처: 루트 CBV b0 ~ b(N-1) 다음에 루트 SRV t0 ~ t(M-1), 모든 셰이더 단계에서 보임
+	const uint32_t parameterCount = desc.ConstantBufferCount + desc.ShaderResourceCount;
+	std::vector<D3D12_ROOT_PARAMETER> rootParameters(parameterCount);
+	for (uint32_t i = 0; i < parameterCount; ++i)
+	{
+		const bool isConstantBuffer = i < desc.ConstantBufferCount;
+
+		rootParameters[i] = {};
+		rootParameters[i].ParameterType = isConstantBuffer ? D3D12_ROOT_PARAMETER_TYPE_CBV : D3D12_ROOT_PARAMETER_TYPE_SRV;
+		rootParameters[i].Descriptor.ShaderRegister = isConstantBuffer ? i : i - desc.ConstantBufferCount;
+		rootParameters[i].Descriptor.RegisterSpace = 0;
+		rootParameters[i].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	}
+
+	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc = {};
+	rootSignatureDesc.NumParameters = parameterCount;
+	rootSignatureDesc.pParameters = rootParameters.data();
+	rootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+
+	ComPtr<ID3DBlob> signature;
+	ComPtr<ID3DBlob> error;
+	ThrowIfFailed(D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error));
+
+	ComPtr<ID3D12RootSignature> rootSignature;
+	ThrowIfFailed(m_device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&rootSignature)));
+
+	std::vector<D3D12_INPUT_ELEMENT_DESC> inputLayout(desc.InputElementCount);
+	for (uint32_t i = 0; i < desc.InputElementCount; ++i)
+	{
+		const RHIInputElement& element = desc.InputLayout[i];
+		inputLayout[i] = { element.SemanticName, element.SemanticIndex, D3D12RHI::ToDxgiFormat(element.Format),
+			element.InputSlot, element.Offset, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+	}
+
+	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
+	psoDesc.pRootSignature = rootSignature.Get();
+	psoDesc.VS = { desc.VertexShader.Data, desc.VertexShader.Size };
+	psoDesc.PS = { desc.PixelShader.Data, desc.PixelShader.Size };
+
+	psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
+	psoDesc.RasterizerState.CullMode = ToCullMode(desc.CullMode);
+	psoDesc.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+
+	psoDesc.InputLayout = { inputLayout.data(), desc.InputElementCount };
+	psoDesc.PrimitiveTopologyType = ToTopologyType(desc.Topology);
+
+	psoDesc.NumRenderTargets = (desc.RenderTargetFormat != RHIFormat::Unknown) ? 1 : 0;
+	psoDesc.RTVFormats[0] = D3D12RHI::ToDxgiFormat(desc.RenderTargetFormat);
+	psoDesc.DSVFormat = D3D12RHI::ToDxgiFormat(desc.DepthStencilFormat);
+	psoDesc.SampleMask = UINT_MAX;
+	psoDesc.SampleDesc.Count = 1;
+
+	psoDesc.DepthStencilState.DepthEnable = desc.DepthTest ? TRUE : FALSE;
+	psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
+	psoDesc.DepthStencilState.DepthWriteMask = desc.DepthWrite ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
+
+	// 디스크 라이브러리에 같은 키로 저장된 것이 있으면 컴파일 없이 꺼냅니다. (설명이 다르면 실패하므로 그때는 새로 컴파일)
+	ComPtr<ID3D12PipelineState> pipelineState;
+	const std::wstring libraryName = m_pipelineLibrary ? RHIPipelineKey::Create(desc).ToName() : std::wstring();
+	if (m_pipelineLibrary && SUCCEEDED(m_pipelineLibrary->LoadGraphicsPipeline(libraryName.c_str(), &psoDesc, IID_PPV_ARGS(&pipelineState))))
+	{
+		++m_pipelineLibraryHits;
+	}
+	else
+	{
+		ThrowIfFailed(m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
+		++m_pipelineCompiles;
+
+		// 지금 라이브러리에는 넣지 않습니다. 같은 이름의 옛 항목이 있으면 StorePipeline이 실패하기 때문에,
+		// 저장할 때 이번 실행의 파이프라인만으로 새로 만듭니다.
+		m_pipelineLibraryDirty = true;
+	}
+
+	if (m_pipelineLibrary)
+	{
+		m_pipelineLibraryEntries.push_back({ libraryName, pipelineState });
+	}
+
+	return std::make_unique<D3D12RHIPipeline>(std::move(rootSignature), std::move(pipelineState), desc.ConstantBufferCount);
+}
+
+std::unique_ptr<RHICommandList> D3D12RHIDevice::CreateCommandList(RHIQueueType type)
+{
+	return std::make_unique<D3D12RHICommandList>(m_device.Get(), D3D12RHI::ToCommandListType(type));
+}
+
+std::unique_ptr<RHIFence> D3D12RHIDevice::CreateFence(uint64_t initialValue)
+{
+	return std::make_unique<D3D12RHIFence>(m_device.Get(), initialValue);
+}
+
+RHICommandQueue* D3D12RHIDevice::GetQueue(RHIQueueType type)
+{
+	std::unique_ptr<D3D12RHICommandQueue>& queue = m_queues[static_cast<size_t>(type)];
+	if (!queue)
+	{
+		D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+		queueDesc.Type = D3D12RHI::ToCommandListType(type);
+
+		ComPtr<ID3D12CommandQueue> nativeQueue;
+		ThrowIfFailed(m_device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&nativeQueue)));
+		queue = std::make_unique<D3D12RHICommandQueue>(std::move(nativeQueue));
+	}
+	return queue.get();
+}
+
+std::unique_ptr<RHICommandList> D3D12RHIDevice::WrapCommandList(ID3D12GraphicsCommandList* commandList)
+{
+	return std::make_unique<D3D12RHICommandList>(commandList);
+}
+
+bool D3D12RHIDevice::LoadPipelineLibrary(const std::wstring& path)
+{
+	m_pipelineLibraryPath = path;
+	m_pipelineLibrary.Reset();
+	m_pipelineLibraryData.clear();
+	m_pipelineLibraryEntries.clear();
+	m_pipelineLibraryDirty = false;
+
+	// 파이프라인 라이브러리는 ID3D12Device1부터 지원합니다.
+	ComPtr<ID3D12Device1> device1;
+	if (FAILED(m_device.As(&device1))) return false;
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (file)
+	{
+		m_pipelineLibraryData.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(m_pipelineLibraryData.data()), m_pipelineLibraryData.size());
+	}
+
+	if (!m_pipelineLibraryData.empty() &&
+		SUCCEEDED(device1->CreatePipelineLibrary(m_pipelineLibraryData.data(), m_pipelineLibraryData.size(), IID_PPV_ARGS(&m_pipelineLibrary))))
+	{
+		return true;
+	}
+
+	// 파일이 없거나, 드라이버/어댑터가 바뀌었거나, 깨진 파일: 빈 라이브러리로 다시 채웁니다.
+	m_pipelineLibraryData.clear();
+	if (FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pipelineLibrary))))
+	{
+		m_pipelineLibrary.Reset(); // 지원하지 않는 드라이버: 매번 컴파일
+	}
+	return false;
+}
+
+bool D3D12RHIDevice::SavePipelineLibrary()
+{
+	if (!m_pipelineLibrary || !m_pipelineLibraryDirty) return false;
+
+	// 읽어 온 라이브러리에 덧붙이면 셰이더가 바뀔 때마다 옛 항목이 쌓이므로, 빈 라이브러리에 이번 실행분만 넣습니다.
+	ComPtr<ID3D12Device1> device1;
+	ComPtr<ID3D12PipelineLibrary> library;
+	if (FAILED(m_device.As(&device1)) || FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&library)))) return false;
+
+	for (const PipelineLibraryEntry& entry : m_pipelineLibraryEntries)
+	{
+		// 여러 PipelineCache가 같은 설명을 만들면 이름이 겹치는데, 먼저 넣은 것과 같은 파이프라인이므로 실패해도 됩니다.
+		library->StorePipeline(entry.Name.c_str(), entry.PipelineState.Get());
+	}
+
+	std::vector<uint8_t> data(library->GetSerializedSize());
+	if (FAILED(library->Serialize(data.data(), data.size()))) return false;
+
+	std::ofstream file(m_pipelineLibraryPath, std::ios::binary | std::ios::trunc);
+	if (!file) return false;
+
+	file.write(reinterpret_cast<const char*>(data.data()), data.size());
+	m_pipelineLibraryDirty = false;
+	return file.good();
+}
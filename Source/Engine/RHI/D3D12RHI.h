@@ -0,0 +1,205 @@
+// D3D12RHI.h
+#pragma once
+
+#include <windows.h>
+#include <wrl.h>
+#include <d3d12.h>
+#include <dxgiformat.h>
+#include <string>
+#include <vector>
+
+#include "RHI/RHI.h"
+#include "RHI/D3D12MemoryAllocator.h"
+
+/*
+ * [D3D12RHI]
+ * RHI의 D3D12 구현입니다.
+ * D3D12App이 만든 디바이스와 다이렉트 큐를 감싸며, 복사/컴퓨트 큐는 처음 요청할 때 만듭니다.
+ * 버퍼/텍스처는 D3D12MemoryAllocator의 큰 힙에 배치 리소스로 만들고, 리소스가 소멸할 때 그 구간을 돌려줍니다.
+ * LoadPipelineLibrary를 부르면 파이프라인을 ID3D12PipelineLibrary에서 먼저 찾고(RHIPipelineKey 이름),
+ * 없으면 컴파일합니다. SavePipelineLibrary는 이번 실행에 쓴 파이프라인만으로 라이브러리를 새로 만들어 파일에 쓰므로,
+ * 셰이더가 바뀌어 더는 쓰지 않는 옛 항목은 다음 저장에서 빠집니다. (다음 실행부터 컴파일 생략)
+ * 스왑체인이나 ImGui처럼 아직 RHI 밖에 있는 코드와 섞어 쓸 수 있도록 원본(Native) 객체를 꺼낼 수 있습니다.
+ */
+namespace D3D12RHI
+{
+	DXGI_FORMAT ToDxgiFormat(RHIFormat format);
+	D3D12_RESOURCE_STATES ToResourceState(RHIResourceState state);
+	D3D12_COMMAND_LIST_TYPE ToCommandListType(RHIQueueType type);
+	D3D12_PRIMITIVE_TOPOLOGY ToPrimitiveTopology(RHIPrimitiveTopology topology);
+}
+
+class D3D12RHIBuffer final : public RHIBuffer
+{
+public:
+	D3D12RHIBuffer(const RHIBufferDesc& desc, Microsoft::WRL::ComPtr<ID3D12Resource> resource,
+		D3D12MemoryAllocator* allocator = nullptr, const D3D12MemoryAllocation& allocation = {});
+	~D3D12RHIBuffer() override;
+
+	uint64_t GetGPUAddress() const override { return m_resource->GetGPUVirtualAddress(); }
+	void* GetNativeHandle() const override { return m_resource.Get(); }
+	void* Map() override;
+	void Unmap() override;
+
+	ID3D12Resource* GetNative() const { return m_resource.Get(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_resource;
+	D3D12MemoryAllocator* m_allocator;
+	D3D12MemoryAllocation m_allocation;
+};
+
+class D3D12RHITexture final : public RHITexture
+{
+public:
+	D3D12RHITexture(const RHITextureDesc& desc, Microsoft::WRL::ComPtr<ID3D12Resource> resource,
+		D3D12MemoryAllocator* allocator = nullptr, const D3D12MemoryAllocation& allocation = {});
+	~D3D12RHITexture() override;
+
+	uint64_t GetGPUAddress() const override { return m_resource->GetGPUVirtualAddress(); }
+	void* GetNativeHandle() const override { return m_resource.Get(); }
+
+	ID3D12Resource* GetNative() const { return m_resource.Get(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Resource> m_resource;
+	D3D12MemoryAllocator* m_allocator;
+	D3D12MemoryAllocation m_allocation;
+};
+
+class D3D12RHIPipeline final : public RHIPipeline
+{
+public:
+	D3D12RHIPipeline(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature,
+		Microsoft::WRL::ComPtr<ID3D12PipelineState> pipelineState, uint32_t constantBufferCount)
+		: m_rootSignature(std::move(rootSignature)), m_pipelineState(std::move(pipelineState)),
+		m_constantBufferCount(constantBufferCount) {}
+
+	ID3D12RootSignature* GetRootSignature() const { return m_rootSignature.Get(); }
+	ID3D12PipelineState* GetPipelineState() const { return m_pipelineState.Get(); }
+	uint32_t GetConstantBufferCount() const { return m_constantBufferCount; } // 루트 SRV는 이 번호부터 시작
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12RootSignature> m_rootSignature;
+	Microsoft::WRL::ComPtr<ID3D12PipelineState> m_pipelineState;
+	uint32_t m_constantBufferCount;
+};
+
+class D3D12RHIFence final : public RHIFence
+{
+public:
+	D3D12RHIFence(ID3D12Device* device, uint64_t initialValue);
+	~D3D12RHIFence() override;
+
+	uint64_t GetCompletedValue() const override { return m_fence->GetCompletedValue(); }
+	void Wait(uint64_t value) override;
+
+	ID3D12Fence* GetNative() const { return m_fence.Get(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Fence> m_fence;
+	HANDLE m_event = nullptr;
+};
+
+/*
+ * [D3D12RHICommandList]
+ * - 디바이스가 만든 리스트: 할당자와 리스트를 직접 소유하고 Reset/Close도 합니다.
+ * - WrapCommandList로 감싼 리스트: CommandListPool의 리스트처럼 소유자가 Reset/Close를 하므로
+ *   여기서의 Reset/Close는 아무것도 하지 않습니다.
+ */
+class D3D12RHICommandList final : public RHICommandList
+{
+public:
+	D3D12RHICommandList(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type);
+	explicit D3D12RHICommandList(ID3D12GraphicsCommandList* externalList);
+
+	void Reset() override;
+	void Close() override;
+
+	void SetPipeline(const RHIPipeline* pipeline) override;
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+	void SetVertexBuffer(uint32_t slot, const RHIBuffer* buffer, uint32_t stride, uint64_t offset) override;
+	void SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format, uint64_t offset) override;
+	void SetConstantBuffer(uint32_t slot, uint64_t gpuAddress) override;
+	void SetShaderResource(uint32_t slot, uint64_t gpuAddress) override;
+	void SetViewport(const RHIViewport& viewport) override;
+	void SetScissorRect(const RHIRect& rect) override;
+	void DrawIndexed(uint32_t indexCount, uint32_t instanceCount,
+		uint32_t startIndex, int32_t baseVertex, uint32_t startInstance) override;
+	void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance) override;
+	void ResourceBarrier(const RHIResource* resource, RHIResourceState before, RHIResourceState after) override;
+	void CopyBuffer(const RHIBuffer* destination, uint64_t destinationOffset,
+		const RHIBuffer* source, uint64_t sourceOffset, uint64_t size) override;
+
+	ID3D12GraphicsCommandList* GetNative() const { return m_commandList.Get(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_allocator; // 감싼 리스트면 nullptr
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_commandList;
+	uint32_t m_rootShaderResourceBase = 0; // 현재 파이프라인에서 t0의 루트 파라미터 번호
+};
+
+class D3D12RHICommandQueue final : public RHICommandQueue
+{
+public:
+	explicit D3D12RHICommandQueue(Microsoft::WRL::ComPtr<ID3D12CommandQueue> queue) : m_queue(std::move(queue)) {}
+
+	void Submit(RHICommandList* const* commandLists, uint32_t count) override;
+	void Signal(RHIFence& fence, uint64_t value) override;
+	void WaitForFence(RHIFence& fence, uint64_t value) override;
+
+	ID3D12CommandQueue* GetNative() const { return m_queue.Get(); }
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_queue;
+};
+
+class D3D12RHIDevice final : public RHIDevice
+{
+public:
+	D3D12RHIDevice(ID3D12Device* device, ID3D12CommandQueue* directQueue);
+
+	std::unique_ptr<RHIBuffer> CreateBuffer(const RHIBufferDesc& desc) override;
+	std::unique_ptr<RHITexture> CreateTexture(const RHITextureDesc& desc) override;
+	std::unique_ptr<RHIPipeline> CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc) override;
+	std::unique_ptr<RHICommandList> CreateCommandList(RHIQueueType type) override;
+	std::unique_ptr<RHIFence> CreateFence(uint64_t initialValue) override;
+
+	RHICommandQueue* GetQueue(RHIQueueType type) override;
+
+	// 이미 만들어진 커맨드 리스트를 RHI로 감쌉니다. (Reset/Close는 호출자가 계속 직접)
+	std::unique_ptr<RHICommandList> WrapCommandList(ID3D12GraphicsCommandList* commandList);
+
+	// 디스크 파이프라인 라이브러리를 엽니다. 파일이 없거나 드라이버가 바뀌어 못 쓰면 빈 라이브러리로 시작하고 false를 돌려줍니다.
+	bool LoadPipelineLibrary(const std::wstring& path);
+	// 새로 컴파일한 파이프라인이 있을 때만, 이번 실행에 쓴 파이프라인으로 라이브러리를 다시 만들어 파일에 씁니다.
+	// (예외 없음: 종료 중에도 부를 수 있음)
+	bool SavePipelineLibrary();
+
+	uint32_t GetPipelineLibraryHitCount() const { return m_pipelineLibraryHits; }
+	uint32_t GetPipelineCompileCount() const { return m_pipelineCompiles; }
+
+	ID3D12Device* GetNative() const { return m_device.Get(); }
+	D3D12MemoryAllocator& GetMemoryAllocator() { return m_memoryAllocator; }
+
+private:
+	// 이번 실행에 만든(또는 라이브러리에서 꺼낸) 파이프라인. 저장할 때 이것들만 새 라이브러리에 넣습니다.
+	struct PipelineLibraryEntry
+	{
+		std::wstring Name;
+		Microsoft::WRL::ComPtr<ID3D12PipelineState> PipelineState;
+	};
+
+	Microsoft::WRL::ComPtr<ID3D12Device> m_device;
+	D3D12MemoryAllocator m_memoryAllocator; // 이 디바이스로 만든 버퍼/텍스처보다 오래 살아야 합니다.
+	std::unique_ptr<D3D12RHICommandQueue> m_queues[3]; // RHIQueueType 순서, Direct 외에는 처음 요청 시 생성
+
+	// 라이브러리는 생성에 쓴 데이터를 계속 참조하므로 데이터가 먼저 선언되어야 합니다. (나중에 소멸)
+	std::vector<uint8_t> m_pipelineLibraryData;
+	Microsoft::WRL::ComPtr<ID3D12PipelineLibrary> m_pipelineLibrary;
+	std::wstring m_pipelineLibraryPath;
+	std::vector<PipelineLibraryEntry> m_pipelineLibraryEntries;
+	bool m_pipelineLibraryDirty = false;
+	uint32_t m_pipelineLibraryHits = 0;
+	uint32_t m_pipelineCompiles = 0;
+};
@@ -0,0 +1,188 @@
+#include "NullRHI.h"
+
+uint64_t NullRHICommandStats::GetTotalCommands() const
+{
+	uint64_t total = 0;
+	for (uint64_t count : CommandCounts) total += count;
+	return total;
+}
+
+void NullRHICommandStats::Add(const NullRHICommandStats& other)
+{
+	for (size_t i = 0; i < static_cast<size_t>(NullRHICommandType::Count); ++i)
+	{
+		CommandCounts[i] += other.CommandCounts[i];
+	}
+	Instances += other.Instances;
+	Primitives += other.Primitives;
+}
+
+NullRHIBuffer::NullRHIBuffer(const RHIBufferDesc& desc, uint64_t gpuAddress)
+	: RHIBuffer(desc)
+	, m_gpuAddress(gpuAddress)
+{
+	// Default 힙은 CPU에서 볼 수 없으므로 메모리를 잡지 않습니다.
+	if (desc.HeapType != RHIHeapType::Default)
+	{
+		m_memory.resize(static_cast<size_t>(desc.Size));
+	}
+}
+
+void* NullRHIBuffer::Map()
+{
+	return m_memory.empty() ? nullptr : m_memory.data();
+}
+
+// ---------------------------------------------------------------------------
+// 명령별 기록 형식
+// SetPipeline:          Object = 파이프라인
+// SetPrimitiveTopology: Args[0] = 토폴로지
+// SetVertexBuffer:      Object = 버퍼, Value = 오프셋, Args[0] = 슬롯, Args[1] = 스트라이드
+// SetIndexBuffer:       Object = 버퍼, Value = 오프셋, Args[0] = 포맷
+// SetConstantBuffer:    Value = GPU 주소, Args[0] = 슬롯
+// SetShaderResource:    Value = GPU 주소, Args[0] = 슬롯
+// SetViewport:          Args[0..1] = 너비, 높이 (정수로 자름)
+// SetScissorRect:       Args[0..3] = left, top, right, bottom
+// DrawIndexed:          Args = indexCount, instanceCount, startIndex, baseVertex, startInstance
+// Draw:                 Args = vertexCount, instanceCount, startVertex, startInstance
+// ResourceBarrier:      Object = 리소스, Args[0..1] = before, after
+// CopyBuffer:           Object = 대상 버퍼, Value = 크기, Args[0..1] = 대상/원본 오프셋 (하위 32비트)
+// ---------------------------------------------------------------------------
+
+void NullRHICommandList::Reset()
+{
+	m_commands.clear();
+	m_stats = {};
+	m_closed = false;
+}
+
+void NullRHICommandList::Record(const NullRHICommand& command)
+{
+	++m_stats.CommandCounts[static_cast<size_t>(command.Type)];
+	if (m_recording) m_commands.push_back(command);
+}
+
+void NullRHICommandList::SetPipeline(const RHIPipeline* pipeline)
+{
+	Record({ NullRHICommandType::SetPipeline, pipeline });
+}
+
+void NullRHICommandList::SetPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	Record({ NullRHICommandType::SetPrimitiveTopology, nullptr, 0, { static_cast<uint32_t>(topology) } });
+}
+
+void NullRHICommandList::SetVertexBuffer(uint32_t slot, const RHIBuffer* buffer, uint32_t stride, uint64_t offset)
+{
+	Record({ NullRHICommandType::SetVertexBuffer, buffer, offset, { slot, stride } });
+}
+
+void NullRHICommandList::SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format, uint64_t offset)
+{
+	Record({ NullRHICommandType::SetIndexBuffer, buffer, offset, { static_cast<uint32_t>(format) } });
+}
+
+void NullRHICommandList::SetConstantBuffer(uint32_t slot, uint64_t gpuAddress)
+{
+	Record({ NullRHICommandType::SetConstantBuffer, nullptr, gpuAddress, { slot } });
+}
+
+void NullRHICommandList::SetShaderResource(uint32_t slot, uint64_t gpuAddress)
+{
+	Record({ NullRHICommandType::SetShaderResource, nullptr, gpuAddress, { slot } });
+}
+
+void NullRHICommandList::SetViewport(const RHIViewport& viewport)
+{
+	Record({ NullRHICommandType::SetViewport, nullptr, 0,
+		{ static_cast<uint32_t>(viewport.Width), static_cast<uint32_t>(viewport.Height) } });
+}
+
+void NullRHICommandList::SetScissorRect(const RHIRect& rect)
+{
+	Record({ NullRHICommandType::SetScissorRect, nullptr, 0,
+		{ static_cast<uint32_t>(rect.Left), static_cast<uint32_t>(rect.Top),
+		  static_cast<uint32_t>(rect.Right), static_cast<uint32_t>(rect.Bottom) } });
+}
+
+void NullRHICommandList::DrawIndexed(uint32_t indexCount, uint32_t instanceCount,
+	uint32_t startIndex, int32_t baseVertex, uint32_t startInstance)
+{
+	m_stats.Instances += instanceCount;
+	m_stats.Primitives += static_cast<uint64_t>(indexCount / 3) * instanceCount;
+	Record({ NullRHICommandType::DrawIndexed, nullptr, 0,
+		{ indexCount, instanceCount, startIndex, static_cast<uint32_t>(baseVertex), startInstance } });
+}
+
+void NullRHICommandList::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance)
+{
+	m_stats.Instances += instanceCount;
+	m_stats.Primitives += static_cast<uint64_t>(vertexCount / 3) * instanceCount;
+	Record({ NullRHICommandType::Draw, nullptr, 0, { vertexCount, instanceCount, startVertex, startInstance } });
+}
+
+void NullRHICommandList::ResourceBarrier(const RHIResource* resource, RHIResourceState before, RHIResourceState after)
+{
+	Record({ NullRHICommandType::ResourceBarrier, resource, 0,
+		{ static_cast<uint32_t>(before), static_cast<uint32_t>(after) } });
+}
+
+void NullRHICommandList::CopyBuffer(const RHIBuffer* destination, uint64_t destinationOffset,
+	const RHIBuffer* /*source*/, uint64_t sourceOffset, uint64_t size)
+{
+	Record({ NullRHICommandType::CopyBuffer, destination, size,
+		{ static_cast<uint32_t>(destinationOffset), static_cast<uint32_t>(sourceOffset) } });
+}
+
+void NullRHICommandQueue::Submit(RHICommandList* const* commandLists, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		m_submittedStats.Add(static_cast<const NullRHICommandList*>(commandLists[i])->GetStats());
+	}
+	++m_submitCount;
+}
+
+void NullRHICommandQueue::Signal(RHIFence& fence, uint64_t value)
+{
+	static_cast<NullRHIFence&>(fence).SetValue(value);
+}
+
+std::unique_ptr<RHIBuffer> NullRHIDevice::CreateBuffer(const RHIBufferDesc& desc)
+{
+	return std::make_unique<NullRHIBuffer>(desc, AllocateAddress(desc.Size));
+}
+
+std::unique_ptr<RHITexture> NullRHIDevice::CreateTexture(const RHITextureDesc& desc)
+{
+	return std::make_unique<NullRHITexture>(desc, AllocateAddress(static_cast<uint64_t>(desc.Width) * desc.Height * 4));
+}
+
+std::unique_ptr<RHIPipeline> NullRHIDevice::CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc)
+{
+	return std::make_unique<NullRHIPipeline>(desc);
+}
+
+std::unique_ptr<RHICommandList> NullRHIDevice::CreateCommandList(RHIQueueType)
+{
+	return std::make_unique<NullRHICommandList>();
+}
+
+std::unique_ptr<RHIFence> NullRHIDevice::CreateFence(uint64_t initialValue)
+{
+	return std::make_unique<NullRHIFence>(initialValue);
+}
+
+RHICommandQueue* NullRHIDevice::GetQueue(RHIQueueType type)
+{
+	return &m_queues[static_cast<size_t>(type)];
+}
+
+uint64_t NullRHIDevice::AllocateAddress(uint64_t size)
+{
+	// D3D12 리소스처럼 64KB 단위로 정렬해 겹치지 않게 나눠 줍니다.
+	constexpr uint64_t ALIGNMENT = 64 * 1024;
+	const uint64_t address = m_nextAddress;
+	m_nextAddress += (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT + ALIGNMENT;
+	return address;
+}
@@ -0,0 +1,181 @@
+// NullRHI.h
+#pragma once
+
+#include <vector>
+
+#include "RHI/RHI.h"
+
+/*
+ * [NullRHI]
+ * GPU 없이 동작하는 RHI 백엔드입니다.
+ * - 버퍼는 시스템 메모리에 만들고, GPU 주소는 디바이스마다 겹치지 않는 가짜 주소를 줍니다.
+ * - 커맨드 리스트는 명령을 메모리에 기록하고 종류별로 셉니다. (SetRecording(false)면 세기만)
+ * - 큐에 제출하면 즉시 '실행된' 것으로 보고 통계를 합산하며, Signal은 바로 펜스 값을 올립니다.
+ *
+ * Render3DScene과 같은 CPU 제출 비용을 Linux 빌드/벤치마크 머신에서 재거나,
+ * 드로우 개수를 헤드리스로 회귀 테스트할 때 씁니다.
+ */
+
+enum class NullRHICommandType : uint8_t
+{
+	SetPipeline,
+	SetPrimitiveTopology,
+	SetVertexBuffer,
+	SetIndexBuffer,
+	SetConstantBuffer,
+	SetShaderResource,
+	SetViewport,
+	SetScissorRect,
+	DrawIndexed,
+	Draw,
+	ResourceBarrier,
+	CopyBuffer,
+	Count
+};
+
+// 기록된 명령 하나. 인자의 의미는 명령 종류마다 다릅니다. (NullRHI.cpp 참고)
+struct NullRHICommand
+{
+	NullRHICommandType Type;
+	const void* Object = nullptr; // 파이프라인 / 버퍼 / 리소스
+	uint64_t Value = 0;           // GPU 주소 / 오프셋 / 크기
+	uint32_t Args[5] = {};
+};
+
+struct NullRHICommandStats
+{
+	uint64_t CommandCounts[static_cast<size_t>(NullRHICommandType::Count)] = {};
+	uint64_t Instances = 0; // Draw / DrawIndexed의 instanceCount 합
+	uint64_t Primitives = 0; // 삼각형 리스트 기준 (인덱스 수 / 3) * 인스턴스 수
+
+	uint64_t GetCount(NullRHICommandType type) const { return CommandCounts[static_cast<size_t>(type)]; }
+	uint64_t GetDrawCount() const { return GetCount(NullRHICommandType::DrawIndexed) + GetCount(NullRHICommandType::Draw); }
+	uint64_t GetTotalCommands() const;
+
+	void Add(const NullRHICommandStats& other);
+};
+
+class NullRHIBuffer final : public RHIBuffer
+{
+public:
+	NullRHIBuffer(const RHIBufferDesc& desc, uint64_t gpuAddress);
+
+	uint64_t GetGPUAddress() const override { return m_gpuAddress; }
+	void* Map() override;
+	void Unmap() override {}
+
+private:
+	std::vector<uint8_t> m_memory;
+	uint64_t m_gpuAddress;
+};
+
+class NullRHITexture final : public RHITexture
+{
+public:
+	NullRHITexture(const RHITextureDesc& desc, uint64_t gpuAddress) : RHITexture(desc), m_gpuAddress(gpuAddress) {}
+
+	uint64_t GetGPUAddress() const override { return m_gpuAddress; }
+
+private:
+	uint64_t m_gpuAddress;
+};
+
+class NullRHIPipeline final : public RHIPipeline
+{
+public:
+	explicit NullRHIPipeline(const RHIGraphicsPipelineDesc& desc)
+		: m_constantBufferCount(desc.ConstantBufferCount), m_shaderResourceCount(desc.ShaderResourceCount) {}
+
+	uint32_t GetConstantBufferCount() const { return m_constantBufferCount; }
+	uint32_t GetShaderResourceCount() const { return m_shaderResourceCount; }
+
+private:
+	uint32_t m_constantBufferCount;
+	uint32_t m_shaderResourceCount;
+};
+
+class NullRHIFence final : public RHIFence
+{
+public:
+	explicit NullRHIFence(uint64_t initialValue) : m_value(initialValue) {}
+
+	uint64_t GetCompletedValue() const override { return m_value; }
+	void Wait(uint64_t) override {} // 제출 즉시 완료되므로 기다릴 일이 없습니다.
+
+	void SetValue(uint64_t value) { m_value = value; }
+
+private:
+	uint64_t m_value;
+};
+
+class NullRHICommandList final : public RHICommandList
+{
+public:
+	void Reset() override;
+	void Close() override { m_closed = true; }
+
+	void SetPipeline(const RHIPipeline* pipeline) override;
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+	void SetVertexBuffer(uint32_t slot, const RHIBuffer* buffer, uint32_t stride, uint64_t offset) override;
+	void SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format, uint64_t offset) override;
+	void SetConstantBuffer(uint32_t slot, uint64_t gpuAddress) override;
+	void SetShaderResource(uint32_t slot, uint64_t gpuAddress) override;
+	void SetViewport(const RHIViewport& viewport) override;
+	void SetScissorRect(const RHIRect& rect) override;
+	void DrawIndexed(uint32_t indexCount, uint32_t instanceCount,
+		uint32_t startIndex, int32_t baseVertex, uint32_t startInstance) override;
+	void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance) override;
+	void ResourceBarrier(const RHIResource* resource, RHIResourceState before, RHIResourceState after) override;
+	void CopyBuffer(const RHIBuffer* destination, uint64_t destinationOffset,
+		const RHIBuffer* source, uint64_t sourceOffset, uint64_t size) override;
+
+	// false면 명령을 저장하지 않고 세기만 합니다. (순수 호출 비용 측정용)
+	void SetRecording(bool recording) { m_recording = recording; }
+
+	bool IsClosed() const { return m_closed; }
+	const std::vector<NullRHICommand>& GetCommands() const { return m_commands; }
+	const NullRHICommandStats& GetStats() const { return m_stats; }
+
+private:
+	void Record(const NullRHICommand& command);
+
+	std::vector<NullRHICommand> m_commands;
+	NullRHICommandStats m_stats;
+	bool m_recording = true;
+	bool m_closed = false;
+};
+
+class NullRHICommandQueue final : public RHICommandQueue
+{
+public:
+	void Submit(RHICommandList* const* commandLists, uint32_t count) override;
+	void Signal(RHIFence& fence, uint64_t value) override;
+	void WaitForFence(RHIFence&, uint64_t) override {}
+
+	// 지금까지 제출된 모든 커맨드 리스트의 통계 합
+	const NullRHICommandStats& GetSubmittedStats() const { return m_submittedStats; }
+	uint64_t GetSubmitCount() const { return m_submitCount; }
+	void ResetStats() { m_submittedStats = {}; m_submitCount = 0; }
+
+private:
+	NullRHICommandStats m_submittedStats;
+	uint64_t m_submitCount = 0;
+};
+
+class NullRHIDevice final : public RHIDevice
+{
+public:
+	std::unique_ptr<RHIBuffer> CreateBuffer(const RHIBufferDesc& desc) override;
+	std::unique_ptr<RHITexture> CreateTexture(const RHITextureDesc& desc) override;
+	std::unique_ptr<RHIPipeline> CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc) override;
+	std::unique_ptr<RHICommandList> CreateCommandList(RHIQueueType type) override;
+	std::unique_ptr<RHIFence> CreateFence(uint64_t initialValue) override;
+
+	RHICommandQueue* GetQueue(RHIQueueType type) override;
+
+private:
+	uint64_t AllocateAddress(uint64_t size);
+
+	NullRHICommandQueue m_queues[3]; // RHIQueueType 순서
+	uint64_t m_nextAddress = 0x10000; // 0은 '주소 없음'으로 남겨 둡니다.
+};
@@ -0,0 +1,111 @@
+// PipelineCache.cpp
+#include "RHI/PipelineCache.h"
+
+#include "Utils/StringId.h" // StringId::Hash (FNV-1a)
+
+#include <string_view>
+
+namespace
+{
+	// 키 레이아웃이 바뀌면 올립니다. (예전 디스크 캐시의 이름과 겹치지 않도록)
+	constexpr uint8_t KEY_VERSION = 1;
+
+	class KeyWriter
+	{
+	public:
+		explicit KeyWriter(std::vector<uint8_t>& bytes) : m_bytes(bytes) {}
+
+		template<typename T>
+		void Write(T value)
+		{
+			const uint8_t* data = reinterpret_cast<const uint8_t*>(&value);
+			m_bytes.insert(m_bytes.end(), data, data + sizeof(T));
+		}
+
+		void WriteShader(const RHIShaderBytecode& shader)
+		{
+			const std::string_view code(static_cast<const char*>(shader.Data), shader.Data ? shader.Size : 0);
+			Write<uint64_t>(StringId::Hash(code));
+			Write<uint64_t>(code.size());
+		}
+
+	private:
+		std::vector<uint8_t>& m_bytes;
+	};
+
+	// D3D12는 삼각형/선/점 구분만 파이프라인에 넣으므로 리스트/스트립은 같은 키가 됩니다.
+	uint8_t GetTopologyClass(RHIPrimitiveTopology topology)
+	{
+		switch (topology)
+		{
+		case RHIPrimitiveTopology::LineList:  return 1;
+		case RHIPrimitiveTopology::PointList: return 2;
+		default:                              return 0;
+		}
+	}
+}
+
+RHIPipelineKey RHIPipelineKey::Create(const RHIGraphicsPipelineDesc& desc)
+{
+	RHIPipelineKey key;
+	key.Bytes.reserve(64 + desc.InputElementCount * 24);
+
+	KeyWriter writer(key.Bytes);
+	writer.Write<uint8_t>(KEY_VERSION);
+
+	writer.WriteShader(desc.VertexShader);
+	writer.WriteShader(desc.PixelShader);
+
+	writer.Write<uint32_t>(desc.InputElementCount);
+	for (uint32_t i = 0; i < desc.InputElementCount; ++i)
+	{
+		const RHIInputElement& element = desc.InputLayout[i];
+		writer.Write<uint64_t>(StringId::Hash(element.SemanticName ? element.SemanticName : ""));
+		writer.Write<uint32_t>(element.SemanticIndex);
+		writer.Write<uint8_t>(static_cast<uint8_t>(element.Format));
+		writer.Write<uint32_t>(element.InputSlot);
+		writer.Write<uint32_t>(element.Offset);
+	}
+
+	writer.Write<uint32_t>(desc.ConstantBufferCount);
+	writer.Write<uint32_t>(desc.ShaderResourceCount);
+	writer.Write<uint8_t>(GetTopologyClass(desc.Topology));
+	writer.Write<uint8_t>(static_cast<uint8_t>(desc.RenderTargetFormat));
+	writer.Write<uint8_t>(static_cast<uint8_t>(desc.DepthStencilFormat));
+	writer.Write<uint8_t>(static_cast<uint8_t>(desc.CullMode));
+	writer.Write<uint8_t>(desc.DepthTest ? 1 : 0);
+	writer.Write<uint8_t>(desc.DepthWrite ? 1 : 0);
+
+	key.Hash = StringId::Hash(std::string_view(reinterpret_cast<const char*>(key.Bytes.data()), key.Bytes.size()));
+	return key;
+}
+
+std::wstring RHIPipelineKey::ToName() const
+{
+	static constexpr wchar_t HEX[] = L"0123456789ABCDEF";
+
+	std::wstring name = L"PSO_";
+	for (int shift = 60; shift >= 0; shift -= 4)
+	{
+		name.push_back(HEX[(Hash >> shift) & 0xF]);
+	}
+	return name;
+}
+
+RHIPipeline* PipelineCache::GetOrCreate(const RHIGraphicsPipelineDesc& desc)
+{
+	RHIPipelineKey key = RHIPipelineKey::Create(desc);
+
+	auto it = m_pipelines.find(key);
+	if (it != m_pipelines.end())
+	{
+		++m_hitCount;
+		return it->second.get();
+	}
+
+	++m_missCount;
+	std::unique_ptr<RHIPipeline> pipeline = m_device.CreateGraphicsPipeline(desc);
+	RHIPipeline* result = pipeline.get();
+	m_pipelines.emplace(std::move(key), std::move(pipeline));
+	return result;
+}
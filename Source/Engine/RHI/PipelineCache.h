@@ -0,0 +1,66 @@
+// PipelineCache.h
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RHI/RHI.h"
+
+/*
+ * [RHIPipelineKey]
+ * 그래픽스 파이프라인 설명 전체(셰이더 내용, 입력 레이아웃, 포맷, 상태)를 바이트열로 펼친 키입니다.
+ * - 포인터가 아니라 내용으로 만들므로, 같은 셰이더를 다시 읽어 와도 같은 키가 나옵니다.
+ * - 셰이더 바이트코드는 통째로 넣지 않고 FNV-1a 해시와 크기만 넣습니다.
+ * - 결과에 영향이 없는 값은 정규화합니다. (토폴로지는 삼각형/선/점 구분만)
+ * Hash는 Bytes의 FNV-1a 64비트 해시이며, ToName()은 디스크 파이프라인 라이브러리의 이름으로 씁니다.
+ */
+struct RHIPipelineKey
+{
+	uint64_t Hash = 0;
+	std::vector<uint8_t> Bytes;
+
+	static RHIPipelineKey Create(const RHIGraphicsPipelineDesc& desc);
+
+	std::wstring ToName() const; // "PSO_" + 16자리 16진수
+
+	bool operator==(const RHIPipelineKey& other) const { return Hash == other.Hash && Bytes == other.Bytes; }
+	bool operator!=(const RHIPipelineKey& other) const { return !(*this == other); }
+};
+
+/*
+ * [PipelineCache]
+ * 같은 설명으로 파이프라인을 두 번 만들지 않도록 키별로 하나씩 보관합니다.
+ * 받은 포인터는 캐시가 소멸할 때까지 유효합니다.
+ * 디스크 캐시(ID3D12PipelineLibrary)는 D3D12RHIDevice가 같은 키 이름으로 처리하므로, 여기서는 런타임 중복 제거만 합니다.
+ *
+ * 스레드 안전하지 않습니다. 로딩 스레드(메인)에서만 호출하세요.
+ */
+class PipelineCache
+{
+public:
+	explicit PipelineCache(RHIDevice& device) : m_device(device) {}
+
+	PipelineCache(const PipelineCache&) = delete;
+	PipelineCache& operator=(const PipelineCache&) = delete;
+
+	RHIPipeline* GetOrCreate(const RHIGraphicsPipelineDesc& desc);
+
+	size_t GetCount() const { return m_pipelines.size(); }
+	uint32_t GetHitCount() const { return m_hitCount; }
+	uint32_t GetMissCount() const { return m_missCount; }
+
+private:
+	struct KeyHasher
+	{
+		size_t operator()(const RHIPipelineKey& key) const { return static_cast<size_t>(key.Hash); }
+	};
+
+	RHIDevice& m_device;
+	std::unordered_map<RHIPipelineKey, std::unique_ptr<RHIPipeline>, KeyHasher> m_pipelines;
+
+	uint32_t m_hitCount = 0;
+	uint32_t m_missCount = 0;
+};
@@ -0,0 +1,274 @@
+// RHI.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*
+ * [RHI (Render Hardware Interface)]
+ * 렌더링 코드가 D3D12 객체를 직접 부르지 않도록 하는 얇은 추상화 계층입니다.
+ * - 디바이스 / 버퍼 / 텍스처 / 파이프라인 / 커맨드 리스트 / 큐 / 펜스만 다룹니다.
+ * - D3D12RHI: 실제 D3D12 구현 (Windows)
+ * - NullRHI: GPU 없이 커맨드를 메모리에 기록하고 개수를 세는 구현 (헤드리스 벤치마크/회귀 테스트용)
+ *
+ * 이 헤더는 플랫폼 헤더(windows.h, d3d12.h)를 포함하지 않습니다.
+ * 스왑체인, ImGui 연동처럼 백엔드에 묶인 부분은 D3D12App이 계속 직접 다룹니다.
+ */
+
+enum class RHIFormat : uint8_t
+{
+	Unknown,
+	R8G8B8A8_UNorm,
+	R8G8B8A8_UNorm_sRGB,
+	R16_UInt,
+	R32_UInt,
+	R32_Float,
+	R32G32_Float,
+	R32G32B32_Float,
+	R32G32B32A32_Float,
+	D32_Float,
+	D24_UNorm_S8_UInt,
+};
+
+enum class RHIHeapType : uint8_t
+{
+	Default,  // GPU 전용
+	Upload,   // CPU 쓰기, GPU 읽기 (항상 매핑 가능)
+	Readback, // GPU 쓰기, CPU 읽기
+};
+
+enum class RHIQueueType : uint8_t
+{
+	Direct,
+	Compute,
+	Copy,
+};
+
+enum class RHIResourceState : uint8_t
+{
+	Common,
+	VertexAndConstantBuffer,
+	IndexBuffer,
+	RenderTarget,
+	DepthWrite,
+	PixelShaderResource,
+	CopySource,
+	CopyDest,
+	GenericRead,
+	Present,
+};
+
+enum class RHIPrimitiveTopology : uint8_t
+{
+	TriangleList,
+	TriangleStrip,
+	LineList,
+	PointList,
+};
+
+enum class RHICullMode : uint8_t
+{
+	None,
+	Front,
+	Back,
+};
+
+// 텍스처 용도 (비트 조합)
+enum RHITextureUsage : uint32_t
+{
+	RHI_TEXTURE_USAGE_SHADER_RESOURCE = 1u << 0,
+	RHI_TEXTURE_USAGE_RENDER_TARGET = 1u << 1,
+	RHI_TEXTURE_USAGE_DEPTH_STENCIL = 1u << 2,
+};
+
+struct RHIBufferDesc
+{
+	uint64_t Size = 0;
+	RHIHeapType HeapType = RHIHeapType::Default;
+	RHIResourceState InitialState = RHIResourceState::Common; // Upload 힙은 항상 GenericRead
+};
+
+struct RHITextureDesc
+{
+	uint32_t Width = 1;
+	uint32_t Height = 1;
+	RHIFormat Format = RHIFormat::R8G8B8A8_UNorm;
+	uint32_t Usage = RHI_TEXTURE_USAGE_SHADER_RESOURCE;
+	RHIResourceState InitialState = RHIResourceState::Common;
+	float ClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f }; // 렌더 타겟 최적 클리어 값
+	float ClearDepth = 1.0f;                          // 깊이 버퍼 최적 클리어 값
+};
+
+struct RHIShaderBytecode
+{
+	const void* Data = nullptr;
+	size_t Size = 0;
+};
+
+// 정점 입력 요소 (정점 단위 데이터만 지원)
+struct RHIInputElement
+{
+	const char* SemanticName = nullptr;
+	uint32_t SemanticIndex = 0;
+	RHIFormat Format = RHIFormat::Unknown;
+	uint32_t InputSlot = 0;
+	uint32_t Offset = 0;
+};
+
+/*
+ * 그래픽스 파이프라인 설명입니다.
+ * 루트 시그니처는 ConstantBufferCount개의 루트 CBV(b0, b1, ...) 뒤에
+ * ShaderResourceCount개의 루트 SRV(t0, t1, ...)가 붙은 형태이며 모든 셰이더 단계에서 보입니다.
+ * (SetConstantBuffer / SetShaderResource의 slot = 레지스터 번호)
+ */
+struct RHIGraphicsPipelineDesc
+{
+	RHIShaderBytecode VertexShader;
+	RHIShaderBytecode PixelShader;
+
+	const RHIInputElement* InputLayout = nullptr;
+	uint32_t InputElementCount = 0;
+
+	uint32_t ConstantBufferCount = 1;
+	uint32_t ShaderResourceCount = 0; // 구조화 버퍼(StructuredBuffer)용 루트 SRV
+
+	RHIPrimitiveTopology Topology = RHIPrimitiveTopology::TriangleList; // 삼각형/선/점 구분에만 쓰임
+
+	RHIFormat RenderTargetFormat = RHIFormat::R8G8B8A8_UNorm;
+	RHIFormat DepthStencilFormat = RHIFormat::D32_Float;
+	RHICullMode CullMode = RHICullMode::Back;
+	bool DepthTest = true;
+	bool DepthWrite = true;
+};
+
+struct RHIViewport
+{
+	float X = 0.0f, Y = 0.0f;
+	float Width = 0.0f, Height = 0.0f;
+	float MinDepth = 0.0f, MaxDepth = 1.0f;
+};
+
+struct RHIRect
+{
+	int32_t Left = 0, Top = 0, Right = 0, Bottom = 0;
+};
+
+class RHIResource
+{
+public:
+	virtual ~RHIResource() = default;
+
+	virtual uint64_t GetGPUAddress() const = 0;
+
+	// 백엔드 원본 객체 (D3D12: ID3D12Resource*, Null: nullptr)
+	virtual void* GetNativeHandle() const { return nullptr; }
+};
+
+class RHIBuffer : public RHIResource
+{
+public:
+	// Upload / Readback 힙만 매핑할 수 있습니다. (Default 힙은 nullptr)
+	virtual void* Map() = 0;
+	virtual void Unmap() = 0;
+
+	const RHIBufferDesc& GetDesc() const { return m_desc; }
+
+protected:
+	explicit RHIBuffer(const RHIBufferDesc& desc) : m_desc(desc) {}
+
+	RHIBufferDesc m_desc;
+};
+
+class RHITexture : public RHIResource
+{
+public:
+	const RHITextureDesc& GetDesc() const { return m_desc; }
+
+protected:
+	explicit RHITexture(const RHITextureDesc& desc) : m_desc(desc) {}
+
+	RHITextureDesc m_desc;
+};
+
+class RHIPipeline
+{
+public:
+	virtual ~RHIPipeline() = default;
+};
+
+class RHIFence
+{
+public:
+	virtual ~RHIFence() = default;
+
+	virtual uint64_t GetCompletedValue() const = 0;
+
+	// CPU가 value에 도달할 때까지 기다립니다.
+	virtual void Wait(uint64_t value) = 0;
+};
+
+/*
+ * [RHICommandList]
+ * 한 스레드에서만 기록합니다. Reset -> 기록 -> Close -> RHICommandQueue::Submit 순서입니다.
+ * (GPU가 이전 기록을 다 쓴 뒤에만 Reset해야 합니다.)
+ */
+class RHICommandList
+{
+public:
+	virtual ~RHICommandList() = default;
+
+	virtual void Reset() = 0;
+	virtual void Close() = 0;
+
+	virtual void SetPipeline(const RHIPipeline* pipeline) = 0;
+	virtual void SetPrimitiveTopology(RHIPrimitiveTopology topology) = 0;
+	virtual void SetVertexBuffer(uint32_t slot, const RHIBuffer* buffer, uint32_t stride, uint64_t offset = 0) = 0;
+	virtual void SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format, uint64_t offset = 0) = 0;
+
+	// slot: 파이프라인의 루트 CBV 번호 (b#), gpuAddress: 256바이트 정렬
+	virtual void SetConstantBuffer(uint32_t slot, uint64_t gpuAddress) = 0;
+	// slot: 파이프라인의 루트 SRV 번호 (t#), gpuAddress: 구조화 버퍼의 첫 원소 주소 (4바이트 정렬)
+	virtual void SetShaderResource(uint32_t slot, uint64_t gpuAddress) = 0;
+
+	virtual void SetViewport(const RHIViewport& viewport) = 0;
+	virtual void SetScissorRect(const RHIRect& rect) = 0;
+
+	virtual void DrawIndexed(uint32_t indexCount, uint32_t instanceCount,
+		uint32_t startIndex, int32_t baseVertex, uint32_t startInstance) = 0;
+	virtual void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex, uint32_t startInstance) = 0;
+
+	virtual void ResourceBarrier(const RHIResource* resource, RHIResourceState before, RHIResourceState after) = 0;
+	virtual void CopyBuffer(const RHIBuffer* destination, uint64_t destinationOffset,
+		const RHIBuffer* source, uint64_t sourceOffset, uint64_t size) = 0;
+};
+
+class RHICommandQueue
+{
+public:
+	virtual ~RHICommandQueue() = default;
+
+	// 닫힌 커맨드 리스트들을 순서대로 제출합니다.
+	virtual void Submit(RHICommandList* const* commandLists, uint32_t count) = 0;
+
+	// 큐의 앞선 작업이 끝나면 fence를 value로 설정합니다.
+	virtual void Signal(RHIFence& fence, uint64_t value) = 0;
+
+	// GPU 쪽에서 fence가 value에 도달할 때까지 이 큐를 멈춥니다. (CPU는 기다리지 않음)
+	virtual void WaitForFence(RHIFence& fence, uint64_t value) = 0;
+};
+
+class RHIDevice
+{
+public:
+	virtual ~RHIDevice() = default;
+
+	virtual std::unique_ptr<RHIBuffer> CreateBuffer(const RHIBufferDesc& desc) = 0;
+	virtual std::unique_ptr<RHITexture> CreateTexture(const RHITextureDesc& desc) = 0;
+	virtual std::unique_ptr<RHIPipeline> CreateGraphicsPipeline(const RHIGraphicsPipelineDesc& desc) = 0;
+	virtual std::unique_ptr<RHICommandList> CreateCommandList(RHIQueueType type) = 0;
+	virtual std::unique_ptr<RHIFence> CreateFence(uint64_t initialValue = 0) = 0;
+
+	// 큐는 디바이스가 소유합니다.
+	virtual RHICommandQueue* GetQueue(RHIQueueType type) = 0;
+};
@@ -0,0 +1,103 @@
+// UploadRingBuffer.cpp
+#include "RHI/UploadRingBuffer.h"
+
+#include <stdexcept>
+
+namespace
+{
+	uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+UploadRingBuffer::UploadRingBuffer(RHIDevice& device, uint64_t capacity)
+	: m_capacity(AlignUp(capacity, CONSTANT_BUFFER_ALIGNMENT))
+{
+	m_buffer = device.CreateBuffer({ m_capacity, RHIHeapType::Upload });
+	m_cpuBase = static_cast<uint8_t*>(m_buffer->Map()); // 업로드 힙은 계속 매핑해 둡니다.
+	m_gpuBase = m_buffer->GetGPUAddress();
+}
+
+UploadRingBuffer::~UploadRingBuffer()
+{
+	if (m_buffer)
+	{
+		m_buffer->Unmap();
+	}
+}
+
+void UploadRingBuffer::BeginFrame(uint64_t completedFenceValue)
+{
+	while (!m_inFlight.empty() && m_inFlight.front().FenceValue <= completedFenceValue)
+	{
+		const Segment& segment = m_inFlight.front();
+		m_tail = segment.End;
+		m_usedBytes -= segment.Size;
+		m_inFlight.pop_front();
+	}
+
+	// 완전히 비었으면 앞으로 되돌려 다음 프레임이 되감기 없이 연속으로 쓰게 합니다.
+	if (m_usedBytes == 0)
+	{
+		m_head = m_tail = 0;
+	}
+}
+
+void UploadRingBuffer::EndFrame(uint64_t fenceValue)
+{
+	if (m_frameBytes == 0) return;
+
+	m_inFlight.push_back({ fenceValue, m_head, m_frameBytes });
+	m_frameBytes = 0;
+}
+
+UploadRingBuffer::Allocation UploadRingBuffer::Allocate(uint64_t size, uint64_t alignment)
+{
+	if (size > m_capacity)
+	{
+		throw std::runtime_error("UploadRingBuffer allocation is larger than the buffer!");
+	}
+
+	Allocation allocation;
+	if (!TryAllocate(size, alignment, allocation))
+	{
+		throw std::runtime_error("UploadRingBuffer is Full!");
+	}
+	return allocation;
+}
+
+bool UploadRingBuffer::TryAllocate(uint64_t size, uint64_t alignment, Allocation& outAllocation)
+{
+	if (size > m_capacity) return false;
+
+	uint64_t start = AlignUp(m_head, alignment);
+	uint64_t consumed = (start + size) - m_head; // 정렬 패딩 포함
+
+	if (m_usedBytes == 0 || m_head > m_tail)
+	{
+		// 사용 중인 구간이 [tail, head) 하나뿐: 끝까지 남은 공간, 모자라면 [0, tail)로 되감기
+		if (start + size > m_capacity)
+		{
+			if (m_usedBytes != 0 && size > m_tail) return false;
+
+			// 되감기로 버린 끝부분도 이 프레임이 반납할 때 함께 돌려받습니다.
+			consumed = (m_capacity - m_head) + size;
+			start = 0;
+		}
+	}
+	else if (start + size > m_tail)
+	{
+		// 이미 되감긴 상태: [head, tail) 사이만 쓸 수 있습니다.
+		return false;
+	}
+
+	m_head = start + size;
+	m_usedBytes += consumed;
+	m_frameBytes += consumed;
+
+	outAllocation.CPUAddress = m_cpuBase + start;
+	outAllocation.GPUAddress = m_gpuBase + start;
+	outAllocation.Offset = start;
+	return true;
+}
@@ -0,0 +1,84 @@
+// UploadRingBuffer.h
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+
+#include "RHI/RHI.h"
+
+/*
+ * [UploadRingBuffer]
+ * 프레임마다 쓰고 버리는 업로드 데이터(드로우별 상수 등)용 선형 할당기입니다.
+ * - Upload 힙 버퍼 하나를 계속 매핑해 두고, 요청마다 앞에서부터 잘라 줍니다. (기본 256바이트 정렬)
+ * - 한 프레임에 할당한 구간은 EndFrame(펜스 값)으로 묶어 두었다가,
+ *   GPU가 그 펜스 값을 지나가면 BeginFrame(완료된 값)에서 한꺼번에 반납합니다.
+ * - 끝에 닿으면 0번으로 되감기 때문에 리소스를 새로 만들지 않고 수천 개의 드로우 상수를 채울 수 있습니다.
+ *
+ * 스레드 안전하지 않습니다. 한 스레드(렌더 스레드)에서만 할당하세요.
+ */
+class UploadRingBuffer
+{
+public:
+	static constexpr uint64_t CONSTANT_BUFFER_ALIGNMENT = 256; // D3D12 CBV 주소 정렬
+
+	struct Allocation
+	{
+		void* CPUAddress = nullptr;
+		uint64_t GPUAddress = 0;
+		uint64_t Offset = 0; // 버퍼 안에서의 오프셋
+	};
+
+	UploadRingBuffer(RHIDevice& device, uint64_t capacity);
+	~UploadRingBuffer();
+
+	UploadRingBuffer(const UploadRingBuffer&) = delete;
+	UploadRingBuffer& operator=(const UploadRingBuffer&) = delete;
+
+	// GPU가 completedFenceValue까지 끝냈으므로, 그 이하 펜스로 묶인 구간을 반납합니다.
+	void BeginFrame(uint64_t completedFenceValue);
+	// 지난 EndFrame 이후의 할당을 이 펜스 값에 묶습니다. (큐에 Signal한 직후 호출)
+	void EndFrame(uint64_t fenceValue);
+
+	// 공간이 없으면 std::runtime_error를 던집니다. (capacity를 늘려야 하는 상황)
+	Allocation Allocate(uint64_t size, uint64_t alignment = CONSTANT_BUFFER_ALIGNMENT);
+	// 공간이 없으면 false를 돌려줍니다. (GPU를 기다렸다가 다시 시도할 수 있는 호출자용)
+	bool TryAllocate(uint64_t size, uint64_t alignment, Allocation& outAllocation);
+
+	// 데이터를 복사해 넣고 GPU 주소를 돌려줍니다. (루트 CBV에 바로 넘길 수 있음)
+	template<typename T>
+	uint64_t PushConstants(const T& data)
+	{
+		Allocation allocation = Allocate(sizeof(T));
+		memcpy(allocation.CPUAddress, &data, sizeof(T));
+		return allocation.GPUAddress;
+	}
+
+	RHIBuffer* GetBuffer() const { return m_buffer.get(); } // 복사 원본으로 쓸 때
+	uint64_t GetCapacity() const { return m_capacity; }
+	uint64_t GetUsedBytes() const { return m_usedBytes; }           // 아직 반납되지 않은 바이트 (정렬/되감기 낭비 포함)
+	uint64_t GetFrameBytes() const { return m_frameBytes; }         // 이번 프레임에 쓴 바이트
+	size_t GetInFlightFrameCount() const { return m_inFlight.size(); }
+
+private:
+	// EndFrame으로 닫힌 한 프레임의 구간
+	struct Segment
+	{
+		uint64_t FenceValue;
+		uint64_t End;  // 이 프레임 마지막 할당의 끝 (반납 후 꼬리가 여기로 이동)
+		uint64_t Size; // 정렬/되감기 낭비를 포함한 크기
+	};
+
+	std::unique_ptr<RHIBuffer> m_buffer;
+	uint8_t* m_cpuBase = nullptr;
+	uint64_t m_gpuBase = 0;
+	uint64_t m_capacity = 0;
+
+	uint64_t m_head = 0;      // 다음 할당 위치
+	uint64_t m_tail = 0;      // 아직 GPU가 쓰고 있을 수 있는 가장 오래된 위치
+	uint64_t m_usedBytes = 0; // head == tail일 때 비었는지/가득 찼는지 구분용
+	uint64_t m_frameBytes = 0;
+
+	std::deque<Segment> m_inFlight;
+};
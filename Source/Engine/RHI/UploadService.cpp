@@ -0,0 +1,132 @@
+// UploadService.cpp
+#include "RHI/UploadService.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+UploadService::UploadService(RHIDevice& device, uint64_t stagingCapacity)
+	: m_device(device), m_staging(device, stagingCapacity)
+{
+	m_copyQueue = device.GetQueue(RHIQueueType::Copy);
+	m_fence = device.CreateFence(0);
+
+	for (CopyContext& context : m_contexts)
+	{
+		context.CommandList = device.CreateCommandList(RHIQueueType::Copy);
+	}
+}
+
+UploadService::~UploadService()
+{
+	// 스테이징 버퍼를 GPU가 아직 읽고 있을 수 있으므로 제출한 복사는 끝나야 합니다.
+	if (m_fence)
+	{
+		m_fence->Wait(m_fenceValue);
+	}
+}
+
+std::unique_ptr<RHIBuffer> UploadService::CreateBuffer(const void* data, uint64_t size)
+{
+	std::unique_ptr<RHIBuffer> buffer = m_device.CreateBuffer({ size, RHIHeapType::Default, RHIResourceState::Common });
+	UploadBuffer(*buffer, 0, data, size);
+	return buffer;
+}
+
+void UploadService::UploadBuffer(RHIBuffer& destination, uint64_t destinationOffset, const void* data, uint64_t size)
+{
+	// 이미 끝난 복사의 스테이징 공간을 먼저 돌려받습니다.
+	m_staging.BeginFrame(m_fence->GetCompletedValue());
+
+	// 한 조각이 링 전체를 차지하면 앞 조각이 끝날 때마다 멈추므로, 링의 1/4씩 나눠 올립니다.
+	const uint64_t maxChunkSize = (std::max)(m_staging.GetCapacity() / 4, COPY_ALIGNMENT);
+	const uint8_t* source = static_cast<const uint8_t*>(data);
+
+	uint64_t offset = 0;
+	while (offset < size)
+	{
+		const uint64_t chunkSize = (std::min)(size - offset, maxChunkSize);
+
+		UploadRingBuffer::Allocation allocation;
+		if (!m_staging.TryAllocate(chunkSize, COPY_ALIGNMENT, allocation))
+		{
+			// 스테이징이 가득 참: 쌓인 복사를 내보내고 Copy 큐가 비울 때까지 기다립니다.
+			if (m_recording)
+			{
+				Submit();
+			}
+			m_fence->Wait(m_fenceValue);
+			m_staging.BeginFrame(m_fence->GetCompletedValue());
+			++m_stats.Stalls;
+
+			if (!m_staging.TryAllocate(chunkSize, COPY_ALIGNMENT, allocation))
+			{
+				throw std::runtime_error("UploadService staging buffer is Full!");
+			}
+		}
+
+		memcpy(allocation.CPUAddress, source + offset, chunkSize);
+		BeginRecording().CopyBuffer(&destination, destinationOffset + offset, m_staging.GetBuffer(), allocation.Offset, chunkSize);
+		++m_stats.CopyCommands;
+
+		offset += chunkSize;
+	}
+
+	m_stats.BytesUploaded += size;
+}
+
+void UploadService::Flush(RHICommandQueue* consumer)
+{
+	if (m_recording)
+	{
+		Submit();
+	}
+
+	if (consumer && m_consumerWaitedValue < m_fenceValue)
+	{
+		consumer->WaitForFence(*m_fence, m_fenceValue);
+		m_consumerWaitedValue = m_fenceValue;
+	}
+
+	m_staging.BeginFrame(m_fence->GetCompletedValue());
+}
+
+void UploadService::WaitForIdle()
+{
+	if (m_recording)
+	{
+		Submit();
+	}
+	m_fence->Wait(m_fenceValue);
+	m_staging.BeginFrame(m_fence->GetCompletedValue());
+}
+
+RHICommandList& UploadService::BeginRecording()
+{
+	CopyContext& context = m_contexts[m_contextIndex];
+	if (!m_recording)
+	{
+		// 이 리스트를 마지막으로 제출한 복사가 끝나야 할당자를 Reset할 수 있습니다.
+		m_fence->Wait(context.FenceValue);
+		context.CommandList->Reset();
+		m_recording = true;
+	}
+	return *context.CommandList;
+}
+
+void UploadService::Submit()
+{
+	CopyContext& context = m_contexts[m_contextIndex];
+	context.CommandList->Close();
+
+	RHICommandList* commandList = context.CommandList.get();
+	m_copyQueue->Submit(&commandList, 1);
+	m_copyQueue->Signal(*m_fence, ++m_fenceValue);
+
+	context.FenceValue = m_fenceValue;
+	m_staging.EndFrame(m_fenceValue);
+
+	m_contextIndex = (m_contextIndex + 1) % CONTEXT_COUNT;
+	m_recording = false;
+	++m_stats.Submissions;
+}
@@ -0,0 +1,83 @@
+// UploadService.h
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "RHI/RHI.h"
+#include "RHI/UploadRingBuffer.h"
+
+/*
+ * [UploadService]
+ * 정적 데이터(정점/인덱스 버퍼 등)를 Default 힙 버퍼로 올리는 업로드 경로입니다.
+ * - 데이터는 스테이징 링(UploadRingBuffer)에 복사한 뒤, 전용 Copy 큐에서 CopyBuffer로 옮깁니다.
+ * - 여러 번의 UploadBuffer는 하나의 Copy 커맨드 리스트에 쌓였다가 Flush 때 한 번에 제출됩니다.
+ * - Flush(consumer)는 소비하는 큐(보통 Direct)가 Copy 큐의 펜스를 GPU 쪽에서 기다리게 하므로,
+ *   CPU는 복사가 끝나기를 기다리지 않습니다.
+ * - 버퍼는 Common 상태로 만들고 Copy 큐의 암시적 승격/복귀에 맡기므로 배리어가 필요 없습니다.
+ *   (버퍼는 Copy 큐에서 CopyDest로 승격되고, 실행이 끝나면 Common으로 돌아와 Direct 큐에서 다시 읽기 상태로 승격됩니다.)
+ *
+ * 스테이징 링이 가득 차면 지금까지 쌓인 복사를 제출하고 CPU에서 Copy 큐를 기다린 뒤 이어서 씁니다. (Stalls로 집계)
+ * 스레드 안전하지 않습니다. 메인 스레드에서만 호출하세요.
+ */
+class UploadService
+{
+public:
+	struct Stats
+	{
+		uint64_t BytesUploaded = 0;
+		uint32_t CopyCommands = 0; // 기록한 CopyBuffer 수
+		uint32_t Submissions = 0;  // Copy 큐 제출 수 (업로드를 몇 번으로 묶었는지)
+		uint32_t Stalls = 0;       // 스테이징이 모자라 CPU가 Copy 큐를 기다린 횟수
+	};
+
+	UploadService(RHIDevice& device, uint64_t stagingCapacity);
+	~UploadService();
+
+	UploadService(const UploadService&) = delete;
+	UploadService& operator=(const UploadService&) = delete;
+
+	// Default 힙 버퍼를 만들고 data를 올리는 복사를 기록합니다. (Flush 전까지 GPU에서 읽으면 안 됨)
+	std::unique_ptr<RHIBuffer> CreateBuffer(const void* data, uint64_t size);
+
+	// destination[destinationOffset..]에 data를 올리는 복사를 기록합니다.
+	// 스테이징보다 큰 데이터는 나눠서 복사합니다.
+	void UploadBuffer(RHIBuffer& destination, uint64_t destinationOffset, const void* data, uint64_t size);
+
+	// 쌓인 복사를 Copy 큐에 제출하고, consumer가 있으면 그 큐가 복사 완료를 GPU 쪽에서 기다리게 합니다.
+	// consumer에 제출하는 커맨드 리스트보다 먼저 불러야 합니다.
+	void Flush(RHICommandQueue* consumer);
+
+	// 지금까지 제출한 복사가 모두 끝날 때까지 CPU에서 기다립니다. (종료/리소스 해제 전용)
+	void WaitForIdle();
+
+	const Stats& GetStats() const { return m_stats; }
+	bool HasPendingCopies() const { return m_recording; }
+
+private:
+	static constexpr uint32_t CONTEXT_COUNT = 3;  // 돌려 쓰는 Copy 커맨드 리스트 수
+	static constexpr uint64_t COPY_ALIGNMENT = 16; // 버퍼 복사 원본 정렬 (텍스처가 아니므로 작게)
+
+	// Copy 커맨드 리스트와 그 리스트를 마지막으로 제출한 펜스 값
+	struct CopyContext
+	{
+		std::unique_ptr<RHICommandList> CommandList;
+		uint64_t FenceValue = 0;
+	};
+
+	RHICommandList& BeginRecording();
+	void Submit();
+
+	RHIDevice& m_device;
+	RHICommandQueue* m_copyQueue = nullptr;
+	std::unique_ptr<RHIFence> m_fence;
+	uint64_t m_fenceValue = 0;         // 마지막으로 Signal한 값
+	uint64_t m_consumerWaitedValue = 0; // 소비 큐에 마지막으로 기다리게 한 값
+
+	UploadRingBuffer m_staging;
+	CopyContext m_contexts[CONTEXT_COUNT];
+	uint32_t m_contextIndex = 0;
+	bool m_recording = false;
+
+	Stats m_stats;
+};
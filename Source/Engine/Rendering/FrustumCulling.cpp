@@ -0,0 +1,214 @@
+#include "FrustumCulling.h"
+
+#include "Components/Camera.h"
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include <cmath>
+
+void BoundingSphereBuffer::Resize(size_t count)
+{
+	m_centerX.resize(count);
+	m_centerY.resize(count);
+	m_centerZ.resize(count);
+	m_radius.resize(count);
+	m_count = count;
+}
+
+void BoundingSphereBuffer::Set(size_t index, const XMFLOAT3& center, float radius)
+{
+	m_centerX[index] = center.x;
+	m_centerY[index] = center.y;
+	m_centerZ[index] = center.z;
+	m_radius[index] = radius;
+}
+
+BoundingSphereStreams BoundingSphereBuffer::GetStreams() const
+{
+	return { m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_radius.data(), m_count };
+}
+
+void AabbBuffer::Resize(size_t count)
+{
+	m_centerX.resize(count);
+	m_centerY.resize(count);
+	m_centerZ.resize(count);
+	m_extentX.resize(count);
+	m_extentY.resize(count);
+	m_extentZ.resize(count);
+	m_count = count;
+}
+
+void AabbBuffer::Set(size_t index, const XMFLOAT3& center, const XMFLOAT3& extents)
+{
+	m_centerX[index] = center.x;
+	m_centerY[index] = center.y;
+	m_centerZ[index] = center.z;
+	m_extentX[index] = extents.x;
+	m_extentY[index] = extents.y;
+	m_extentZ[index] = extents.z;
+}
+
+AabbStreams AabbBuffer::GetStreams() const
+{
+	return { m_centerX.data(), m_centerY.data(), m_centerZ.data(),
+		m_extentX.data(), m_extentY.data(), m_extentZ.data(), m_count };
+}
+
+namespace
+{
+	// 평면 하나를 4개 레인에 브로드캐스트한 형태
+	struct SplatPlane
+	{
+		__m128 a, b, c, d;
+		__m128 absA, absB, absC; // AABB 투영 반경 계산용
+	};
+
+	void SplatPlanes(const CameraViewData& view, SplatPlane (&out)[FRUSTUM_PLANE_COUNT])
+	{
+		for (uint32_t p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+		{
+			const XMFLOAT4A& plane = view.FrustumPlanes[p];
+			out[p].a = _mm_set1_ps(plane.x);
+			out[p].b = _mm_set1_ps(plane.y);
+			out[p].c = _mm_set1_ps(plane.z);
+			out[p].d = _mm_set1_ps(plane.w);
+			out[p].absA = _mm_set1_ps(std::fabs(plane.x));
+			out[p].absB = _mm_set1_ps(std::fabs(plane.y));
+			out[p].absC = _mm_set1_ps(std::fabs(plane.z));
+		}
+	}
+
+	// 4비트 마스크에서 켜진 레인의 인덱스를 분기 없이 기록합니다.
+	// (항상 4칸을 쓰고, 보이는 개수만큼만 커서를 전진)
+	inline uint32_t* EmitVisible(uint32_t* cursor, int mask, uint32_t baseIndex)
+	{
+		cursor[0] = baseIndex + 0; cursor += (mask >> 0) & 1;
+		cursor[0] = baseIndex + 1; cursor += (mask >> 1) & 1;
+		cursor[0] = baseIndex + 2; cursor += (mask >> 2) & 1;
+		cursor[0] = baseIndex + 3; cursor += (mask >> 3) & 1;
+		return cursor;
+	}
+
+	// 스칼라 경로 (4개로 나누어 떨어지지 않는 나머지)
+	bool SphereVisibleScalar(const CameraViewData& view, float x, float y, float z, float r)
+	{
+		for (uint32_t p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+		{
+			const XMFLOAT4A& plane = view.FrustumPlanes[p];
+			if (plane.x * x + plane.y * y + plane.z * z + plane.w < -r)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool AabbVisibleScalar(const CameraViewData& view, float x, float y, float z, float ex, float ey, float ez)
+	{
+		for (uint32_t p = 0; p < FRUSTUM_PLANE_COUNT; ++p)
+		{
+			const XMFLOAT4A& plane = view.FrustumPlanes[p];
+			float distance = plane.x * x + plane.y * y + plane.z * z + plane.w;
+			float radius = std::fabs(plane.x) * ex + std::fabs(plane.y) * ey + std::fabs(plane.z) * ez;
+			if (distance + radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+size_t FrustumCulling::CullSpheres(const CameraViewData& view, const BoundingSphereStreams& spheres,
+	std::vector<uint32_t>& outVisible)
+{
+	// EmitVisible이 최대 3칸을 더 쓰므로 여유를 둡니다.
+	outVisible.resize(spheres.Count + 4);
+	uint32_t* cursor = outVisible.data();
+
+	SplatPlane planes[FRUSTUM_PLANE_COUNT];
+	SplatPlanes(view, planes);
+
+	const size_t simdCount = spheres.Count & ~size_t(3);
+	for (size_t i = 0; i < simdCount; i += 4)
+	{
+		const __m128 x = _mm_loadu_ps(spheres.CenterX + i);
+		const __m128 y = _mm_loadu_ps(spheres.CenterY + i);
+		const __m128 z = _mm_loadu_ps(spheres.CenterZ + i);
+		const __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(spheres.Radius + i));
+
+		// 모든 평면에 대해 dot(n, c) + d >= -r 이어야 보입니다.
+		__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (const SplatPlane& plane : planes)
+		{
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(plane.a, x), _mm_mul_ps(plane.b, y)),
+				_mm_add_ps(_mm_mul_ps(plane.c, z), plane.d));
+			visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, negRadius));
+		}
+
+		cursor = EmitVisible(cursor, _mm_movemask_ps(visible), static_cast<uint32_t>(i));
+	}
+
+	for (size_t i = simdCount; i < spheres.Count; ++i)
+	{
+		if (SphereVisibleScalar(view, spheres.CenterX[i], spheres.CenterY[i], spheres.CenterZ[i], spheres.Radius[i]))
+		{
+			*cursor++ = static_cast<uint32_t>(i);
+		}
+	}
+
+	outVisible.resize(static_cast<size_t>(cursor - outVisible.data()));
+	return outVisible.size();
+}
+
+size_t FrustumCulling::CullAabbs(const CameraViewData& view, const AabbStreams& boxes,
+	std::vector<uint32_t>& outVisible)
+{
+	outVisible.resize(boxes.Count + 4);
+	uint32_t* cursor = outVisible.data();
+
+	SplatPlane planes[FRUSTUM_PLANE_COUNT];
+	SplatPlanes(view, planes);
+
+	const __m128 zero = _mm_setzero_ps();
+
+	const size_t simdCount = boxes.Count & ~size_t(3);
+	for (size_t i = 0; i < simdCount; i += 4)
+	{
+		const __m128 x = _mm_loadu_ps(boxes.CenterX + i);
+		const __m128 y = _mm_loadu_ps(boxes.CenterY + i);
+		const __m128 z = _mm_loadu_ps(boxes.CenterZ + i);
+		const __m128 ex = _mm_loadu_ps(boxes.ExtentX + i);
+		const __m128 ey = _mm_loadu_ps(boxes.ExtentY + i);
+		const __m128 ez = _mm_loadu_ps(boxes.ExtentZ + i);
+
+		// 평면 법선 방향으로 투영한 박스 반경 |n| . e 를 더해서 검사합니다.
+		__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (const SplatPlane& plane : planes)
+		{
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(plane.a, x), _mm_mul_ps(plane.b, y)),
+				_mm_add_ps(_mm_mul_ps(plane.c, z), plane.d));
+			__m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(plane.absA, ex), _mm_mul_ps(plane.absB, ey)),
+				_mm_mul_ps(plane.absC, ez));
+			visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+		}
+
+		cursor = EmitVisible(cursor, _mm_movemask_ps(visible), static_cast<uint32_t>(i));
+	}
+
+	for (size_t i = simdCount; i < boxes.Count; ++i)
+	{
+		if (AabbVisibleScalar(view, boxes.CenterX[i], boxes.CenterY[i], boxes.CenterZ[i],
+			boxes.ExtentX[i], boxes.ExtentY[i], boxes.ExtentZ[i]))
+		{
+			*cursor++ = static_cast<uint32_t>(i);
+		}
+	}
+
+	outVisible.resize(static_cast<size_t>(cursor - outVisible.data()));
+	return outVisible.size();
+}
@@ -0,0 +1,88 @@
+// FrustumCulling.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+
+struct CameraViewData;
+
+/*
+ * [BoundingSphereStreams]
+ * 월드 공간 바운딩 스피어들의 SoA 입력입니다. (레지스터 하나에 4개씩 로드)
+ */
+struct BoundingSphereStreams
+{
+	const float* CenterX = nullptr;
+	const float* CenterY = nullptr;
+	const float* CenterZ = nullptr;
+	const float* Radius = nullptr;
+	size_t Count = 0;
+};
+
+/*
+ * [AabbStreams]
+ * 월드 공간 AABB들의 SoA 입력입니다. (중심 + 반크기)
+ */
+struct AabbStreams
+{
+	const float* CenterX = nullptr;
+	const float* CenterY = nullptr;
+	const float* CenterZ = nullptr;
+	const float* ExtentX = nullptr;
+	const float* ExtentY = nullptr;
+	const float* ExtentZ = nullptr;
+	size_t Count = 0;
+};
+
+/*
+ * [BoundingSphereBuffer / AabbBuffer]
+ * 위 스트림들이 가리킬 SoA 배열을 소유하는 버퍼입니다. (TransformStreamBuffer와 같은 사용법)
+ */
+class BoundingSphereBuffer
+{
+public:
+	void Resize(size_t count);
+	void Set(size_t index, const DirectX::XMFLOAT3& center, float radius);
+
+	size_t GetCount() const { return m_count; }
+	BoundingSphereStreams GetStreams() const;
+
+private:
+	std::vector<float> m_centerX, m_centerY, m_centerZ, m_radius;
+	size_t m_count = 0;
+};
+
+class AabbBuffer
+{
+public:
+	void Resize(size_t count);
+	void Set(size_t index, const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents);
+
+	size_t GetCount() const { return m_count; }
+	AabbStreams GetStreams() const;
+
+private:
+	std::vector<float> m_centerX, m_centerY, m_centerZ;
+	std::vector<float> m_extentX, m_extentY, m_extentZ;
+	size_t m_count = 0;
+};
+
+/*
+ * [FrustumCulling]
+ * 카메라의 정규화된 프러스텀 평면(CameraViewData::FrustumPlanes)에 대해
+ * 바운딩 볼륨 4개를 한 번에(SSE) 검사하고, 보이는 것들의 인덱스만
+ * outVisible에 빽빽하게(Compact) 기록합니다.
+ *
+ * 결과 리스트는 호출자가 소유하므로, 뷰(Scene/Game)마다 따로 유지하면 됩니다.
+ * 반환값은 보이는 개수입니다. (outVisible.size()와 같음)
+ */
+namespace FrustumCulling
+{
+	size_t CullSpheres(const CameraViewData& view, const BoundingSphereStreams& spheres,
+		std::vector<uint32_t>& outVisible);
+
+	size_t CullAabbs(const CameraViewData& view, const AabbStreams& boxes,
+		std::vector<uint32_t>& outVisible);
+}
@@ -0,0 +1,191 @@
+#include "MeshLod.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr float MIN_REDUCTION = 0.75f;        // 이전 단계보다 삼각형이 25% 이상 줄어야 새 단계로 인정
+	constexpr size_t MIN_LOD_INDEX_COUNT = 64 * 3; // 이보다 적은 삼각형은 더 줄이지 않음
+	constexpr float FIRST_CELL_DIVISIONS = 256.0f; // LOD 1의 셀 크기 = 대각선 길이 / 256
+
+	inline const XMFLOAT3& PositionAt(const XMFLOAT3* positions, size_t stride, size_t index)
+	{
+		return *reinterpret_cast<const XMFLOAT3*>(reinterpret_cast<const unsigned char*>(positions) + index * stride);
+	}
+
+	struct Cluster
+	{
+		double SumX = 0.0, SumY = 0.0, SumZ = 0.0;
+		uint32_t Count = 0;
+		uint32_t Representative = UINT32_MAX;
+		float BestDistanceSq = 0.0f;
+	};
+}
+
+float MeshLod::SimplifyByClustering(const XMFLOAT3* positions, size_t stride, size_t vertexCount,
+	const uint32_t* indices, size_t indexCount, const Aabb& bounds, float cellSize,
+	std::vector<uint32_t>& outIndices)
+{
+	outIndices.clear();
+	if (vertexCount == 0 || cellSize <= 0.0f) return 0.0f;
+
+	const float invCellSize = 1.0f / cellSize;
+	const XMFLOAT3 origin = { bounds.Center.x - bounds.Extents.x, bounds.Center.y - bounds.Extents.y, bounds.Center.z - bounds.Extents.z };
+
+	// 1. 정점마다 셀을 정하고, 셀별 평균 위치를 구합니다.
+	std::vector<uint32_t> clusterOfVertex(vertexCount);
+	std::vector<Cluster> clusters;
+	std::unordered_map<uint64_t, uint32_t> clusterOfCell;
+	clusterOfCell.reserve(vertexCount / 4);
+
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		const XMFLOAT3& p = PositionAt(positions, stride, i);
+		const uint64_t cx = static_cast<uint64_t>((std::max)(0.0f, (p.x - origin.x) * invCellSize));
+		const uint64_t cy = static_cast<uint64_t>((std::max)(0.0f, (p.y - origin.y) * invCellSize));
+		const uint64_t cz = static_cast<uint64_t>((std::max)(0.0f, (p.z - origin.z) * invCellSize));
+		const uint64_t key = (cx & 0x1FFFFF) | ((cy & 0x1FFFFF) << 21) | ((cz & 0x1FFFFF) << 42);
+
+		auto [it, inserted] = clusterOfCell.try_emplace(key, static_cast<uint32_t>(clusters.size()));
+		if (inserted) clusters.emplace_back();
+
+		Cluster& cluster = clusters[it->second];
+		cluster.SumX += p.x; cluster.SumY += p.y; cluster.SumZ += p.z;
+		++cluster.Count;
+		clusterOfVertex[i] = it->second;
+	}
+
+	// 2. 평균에 가장 가까운 기존 정점을 대표로 고릅니다.
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		Cluster& cluster = clusters[clusterOfVertex[i]];
+		const XMFLOAT3& p = PositionAt(positions, stride, i);
+		const float dx = p.x - static_cast<float>(cluster.SumX / cluster.Count);
+		const float dy = p.y - static_cast<float>(cluster.SumY / cluster.Count);
+		const float dz = p.z - static_cast<float>(cluster.SumZ / cluster.Count);
+		const float distSq = dx * dx + dy * dy + dz * dz;
+
+		if (cluster.Representative == UINT32_MAX || distSq < cluster.BestDistanceSq)
+		{
+			cluster.Representative = static_cast<uint32_t>(i);
+			cluster.BestDistanceSq = distSq;
+		}
+	}
+
+	// 3. 삼각형을 대표 정점으로 다시 잇고, 한 점으로 뭉개진 삼각형은 버립니다.
+	outIndices.reserve(indexCount / 2);
+	for (size_t i = 0; i + 2 < indexCount; i += 3)
+	{
+		const uint32_t a = clusters[clusterOfVertex[indices[i + 0]]].Representative;
+		const uint32_t b = clusters[clusterOfVertex[indices[i + 1]]].Representative;
+		const uint32_t c = clusters[clusterOfVertex[indices[i + 2]]].Representative;
+		if (a == b || b == c || a == c) continue;
+
+		outIndices.push_back(a);
+		outIndices.push_back(b);
+		outIndices.push_back(c);
+	}
+
+	// 4. 기하 오차 = 삼각형에 쓰인 원본 정점이 대표 정점까지 옮겨진 최대 거리
+	float maxErrorSq = 0.0f;
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		const XMFLOAT3& p = PositionAt(positions, stride, i);
+		const XMFLOAT3& r = PositionAt(positions, stride, clusters[clusterOfVertex[i]].Representative);
+		const float dx = p.x - r.x, dy = p.y - r.y, dz = p.z - r.z;
+		maxErrorSq = (std::max)(maxErrorSq, dx * dx + dy * dy + dz * dz);
+	}
+
+	return std::sqrt(maxErrorSq);
+}
+
+void MeshLod::BuildLodChain(const XMFLOAT3* positions, size_t stride, size_t vertexCount,
+	std::vector<uint32_t>& inOutIndices, size_t baseIndexCount, const Aabb& bounds,
+	std::vector<LodLevel>& outLevels)
+{
+	outLevels.clear();
+
+	LodLevel base;
+	base.IndexStart = 0;
+	base.IndexCount = static_cast<uint32_t>(baseIndexCount);
+	base.GeometricError = 0.0f;
+	outLevels.push_back(base);
+
+	const float diagonal = 2.0f * std::sqrt(bounds.Extents.x * bounds.Extents.x +
+		bounds.Extents.y * bounds.Extents.y + bounds.Extents.z * bounds.Extents.z);
+	if (diagonal <= 0.0f) return;
+
+	// 항상 원본에서 바로 클러스터링합니다. (오차가 단계마다 누적되지 않음)
+	std::vector<uint32_t> simplified;
+	float cellSize = diagonal / FIRST_CELL_DIVISIONS;
+
+	while (outLevels.size() < MAX_LOD_LEVELS && outLevels.back().IndexCount > MIN_LOD_INDEX_COUNT)
+	{
+		const float error = SimplifyByClustering(positions, stride, vertexCount,
+			inOutIndices.data(), baseIndexCount, bounds, cellSize, simplified);
+		cellSize *= 2.0f;
+
+		// 거의 줄지 않았으면 이 단계는 건너뛰고 더 큰 셀로 다시 시도합니다.
+		if (simplified.size() > outLevels.back().IndexCount * MIN_REDUCTION)
+		{
+			if (cellSize > diagonal) break;
+			continue;
+		}
+		if (simplified.empty()) break;
+
+		LodLevel level;
+		level.IndexStart = static_cast<uint32_t>(inOutIndices.size());
+		level.IndexCount = static_cast<uint32_t>(simplified.size());
+		level.GeometricError = error;
+		outLevels.push_back(level);
+
+		inOutIndices.insert(inOutIndices.end(), simplified.begin(), simplified.end());
+	}
+}
+
+uint32_t MeshLod::SelectLod(std::span<const LodLevel> levels, float distance, float worldScale, float projectionScaleY,
+	float threshold, uint32_t previousLod, float hysteresis)
+{
+	if (levels.empty()) return 0;
+
+	// 카메라가 바운딩 스피어 안에 있으면 가장 정밀한 단계
+	if (distance <= 0.0f) return 0;
+
+	auto screenError = [&](uint32_t level)
+	{
+		return ComputeScreenError(levels[level].GeometricError * worldScale, distance, projectionScaleY);
+	};
+
+	// 임계값을 만족하는 가장 거친 단계
+	uint32_t desired = 0;
+	for (uint32_t level = static_cast<uint32_t>(levels.size()); level-- > 0;)
+	{
+		if (screenError(level) <= threshold)
+		{
+			desired = level;
+			break;
+		}
+	}
+
+	// 처음이거나 더 정밀한 쪽으로 가는 경우는 바로 따릅니다. (품질 우선)
+	if (previousLod >= levels.size() || desired <= previousLod)
+	{
+		return desired;
+	}
+
+	// 더 거친 쪽으로 갈 때는 여유를 두고, 그 여유 안에서 가능한 가장 거친 단계로만 내려갑니다.
+	const float strictThreshold = threshold * (1.0f - hysteresis);
+	for (uint32_t level = desired; level > previousLod; --level)
+	{
+		if (screenError(level) <= strictThreshold)
+		{
+			return level;
+		}
+	}
+
+	return previousLod;
+}
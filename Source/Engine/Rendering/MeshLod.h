@@ -0,0 +1,65 @@
+// MeshLod.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <DirectXMath.h>
+
+#include "Math/Bounds.h"
+
+// 인덱스 버퍼 안의 LOD 한 단계 구간과 그 단계의 기하 오차
+struct LodLevel
+{
+	uint32_t IndexStart = 0;
+	uint32_t IndexCount = 0;
+	float GeometricError = 0.0f; // 원본 정점이 대표 정점으로 옮겨진 최대 거리 (로컬 공간 단위)
+};
+
+/*
+ * [MeshLod]
+ * 임포트 시 LOD 체인 생성 + 뷰별 LOD 선택.
+ *
+ * 생성: 정점 클러스터링 (Rossignac-Borrel)
+ * - 격자 셀마다 정점들의 평균에 가장 가까운 '기존 정점'을 대표로 고르고, 삼각형을 대표 정점으로 다시 잇습니다.
+ *   (새 정점을 만들지 않으므로 모든 LOD가 같은 정점 버퍼를 공유하고, 인덱스 구간만 다릅니다.)
+ * - 셀 크기를 두 배씩 키우면서 단계를 만들고, 정점이 옮겨진 최대 거리를 오차로 기록합니다.
+ *
+ * 선택: 화면 공간 오차
+ * - 오차 / 거리 * 투영 스케일 = 화면 높이 대비 비율. 이것이 임계값 이하인 가장 거친 단계를 고릅니다.
+ * - 거친 쪽으로 바꿀 때만 임계값을 (1 - hysteresis)배로 더 엄격하게 적용해서
+ *   경계 근처에서 단계가 매 프레임 오가는 팝핑(Popping)을 막습니다.
+ */
+namespace MeshLod
+{
+	constexpr uint32_t MAX_LOD_LEVELS = 6;
+
+	// 셀 크기 cellSize로 클러스터링한 삼각형 리스트를 outIndices에 쓰고, 기하 오차를 반환합니다.
+	float SimplifyByClustering(const DirectX::XMFLOAT3* positions, size_t stride, size_t vertexCount,
+		const uint32_t* indices, size_t indexCount, const Aabb& bounds, float cellSize,
+		std::vector<uint32_t>& outIndices);
+
+	/*
+	 * inOutIndices[0, baseIndexCount)를 LOD 0으로 하고, 더 거친 단계의 인덱스를 inOutIndices 뒤에 덧붙입니다.
+	 * 삼각형이 충분히 줄지 않거나(75% 이상 남음) 너무 적어지면 멈춥니다.
+	 */
+	void BuildLodChain(const DirectX::XMFLOAT3* positions, size_t stride, size_t vertexCount,
+		std::vector<uint32_t>& inOutIndices, size_t baseIndexCount, const Aabb& bounds,
+		std::vector<LodLevel>& outLevels);
+
+	// 화면 높이 대비 오차 비율. projectionScaleY = Projection._22 (= 1 / tan(fovY / 2))
+	inline float ComputeScreenError(float geometricError, float distance, float projectionScaleY)
+	{
+		return geometricError * projectionScaleY * 0.5f / distance;
+	}
+
+	/*
+	 * distance: 카메라에서 바운딩 스피어 표면까지의 거리 (가까운 쪽이 보수적)
+	 * worldScale: 오브젝트의 최대 축 스케일 (로컬 오차 -> 월드 오차)
+	 * threshold: 허용하는 화면 높이 대비 오차 (예: 1.5px / 화면 높이)
+	 * previousLod: 이 뷰에서 지난 프레임에 고른 단계 (처음이면 levels.size() 이상의 값)
+	 */
+	uint32_t SelectLod(std::span<const LodLevel> levels, float distance, float worldScale, float projectionScaleY,
+		float threshold, uint32_t previousLod, float hysteresis = 0.25f);
+}
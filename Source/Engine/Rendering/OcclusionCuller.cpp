@@ -0,0 +1,294 @@
+#include "OcclusionCuller.h"
+
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <xmmintrin.h>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr float MIN_CLIP_W = 1e-4f; // 이보다 작은 w는 카메라 뒤 / 근평면 근처로 봅니다.
+
+	struct MatrixRows
+	{
+		__m128 r0, r1, r2, r3;
+	};
+
+	inline MatrixRows LoadRows(const XMFLOAT4X4& m)
+	{
+		return { _mm_loadu_ps(&m._11), _mm_loadu_ps(&m._21), _mm_loadu_ps(&m._31), _mm_loadu_ps(&m._41) };
+	}
+
+	// 행 벡터 규약 (x, y, z, 1) * M
+	inline __m128 TransformPoint(const MatrixRows& m, float x, float y, float z)
+	{
+		__m128 result = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x), m.r0), _mm_mul_ps(_mm_set1_ps(y), m.r1));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(z), m.r2));
+		return _mm_add_ps(result, m.r3);
+	}
+
+	inline XMFLOAT4X4 Multiply(const XMFLOAT4X4& a, const XMFLOAT4X4& b)
+	{
+		const MatrixRows rows = LoadRows(b);
+		XMFLOAT4X4 result;
+		const float* src = &a._11;
+		float* dst = &result._11;
+		for (int r = 0; r < 4; ++r)
+		{
+			__m128 row = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(src[r * 4 + 0]), rows.r0), _mm_mul_ps(_mm_set1_ps(src[r * 4 + 1]), rows.r1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(src[r * 4 + 2]), rows.r2), _mm_mul_ps(_mm_set1_ps(src[r * 4 + 3]), rows.r3)));
+			_mm_storeu_ps(dst + r * 4, row);
+		}
+		return result;
+	}
+}
+
+OcclusionCuller::OcclusionCuller(uint32_t width, uint32_t height)
+{
+	m_width = (std::max)(TILE_SIZE, (width + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE);
+	m_height = (std::max)(TILE_SIZE, (height + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE);
+	m_tilesX = m_width / TILE_SIZE;
+	m_tilesY = m_height / TILE_SIZE;
+
+	m_depth.assign(static_cast<size_t>(m_width) * m_height, 1.0f);
+	m_tileMaxDepth.assign(static_cast<size_t>(m_tilesX) * m_tilesY, 1.0f);
+}
+
+void OcclusionCuller::BeginFrame(const XMFLOAT4X4& viewProjection)
+{
+	m_viewProjection = viewProjection;
+	std::fill(m_depth.begin(), m_depth.end(), 1.0f);
+	std::fill(m_tileMaxDepth.begin(), m_tileMaxDepth.end(), 1.0f);
+	m_rasterizedTriangles = 0;
+}
+
+void OcclusionCuller::RasterizeOccluder(const XMFLOAT4X4& world,
+	const XMFLOAT3* positions, size_t stride, size_t vertexCount,
+	const uint32_t* indices, size_t indexCount)
+{
+	// 1. 정점을 한 번씩만 화면 공간으로 변환합니다.
+	const MatrixRows wvp = LoadRows(Multiply(world, m_viewProjection));
+	const float halfWidth = 0.5f * static_cast<float>(m_width);
+	const float halfHeight = 0.5f * static_cast<float>(m_height);
+
+	m_screenVertices.resize(vertexCount);
+	const auto* bytes = reinterpret_cast<const unsigned char*>(positions);
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		const XMFLOAT3& p = *reinterpret_cast<const XMFLOAT3*>(bytes + i * stride);
+
+		alignas(16) float clip[4];
+		_mm_store_ps(clip, TransformPoint(wvp, p.x, p.y, p.z));
+
+		ScreenVertex& v = m_screenVertices[i];
+		v.Valid = clip[3] > MIN_CLIP_W && clip[2] >= 0.0f;
+		if (!v.Valid) continue;
+
+		const float invW = 1.0f / clip[3];
+		v.X = (clip[0] * invW + 1.0f) * halfWidth;
+		v.Y = (1.0f - clip[1] * invW) * halfHeight;
+		v.Z = clip[2] * invW;
+	}
+
+	// 2. 삼각형 래스터화
+	for (size_t i = 0; i + 2 < indexCount; i += 3)
+	{
+		const ScreenVertex& v0 = m_screenVertices[indices[i + 0]];
+		const ScreenVertex& v1 = m_screenVertices[indices[i + 1]];
+		const ScreenVertex& v2 = m_screenVertices[indices[i + 2]];
+
+		// 근평면에 걸친 가리개 삼각형은 그리지 않습니다. (덜 가리는 쪽이므로 안전)
+		if (!v0.Valid || !v1.Valid || !v2.Valid) continue;
+
+		RasterizeTriangle(v0, v1, v2);
+	}
+}
+
+void OcclusionCuller::RasterizeTriangle(const ScreenVertex& v0, const ScreenVertex& in1, const ScreenVertex& in2)
+{
+	// 양면 래스터화: 넓이가 음수면 두 정점을 바꿔 항상 같은 방향으로 만듭니다.
+	float area = (in1.X - v0.X) * (in2.Y - v0.Y) - (in2.X - v0.X) * (in1.Y - v0.Y);
+	const bool flip = area < 0.0f;
+	const ScreenVertex& v1 = flip ? in2 : in1;
+	const ScreenVertex& v2 = flip ? in1 : in2;
+	area = flip ? -area : area;
+	if (area < 1e-8f) return;
+
+	// 화면과 겹치는 픽셀 범위 (x는 4픽셀 묶음 시작점에 맞춤)
+	const float minXf = (std::min)({ v0.X, v1.X, v2.X });
+	const float maxXf = (std::max)({ v0.X, v1.X, v2.X });
+	const float minYf = (std::min)({ v0.Y, v1.Y, v2.Y });
+	const float maxYf = (std::max)({ v0.Y, v1.Y, v2.Y });
+
+	if (maxXf < 0.0f || maxYf < 0.0f || minXf >= static_cast<float>(m_width) || minYf >= static_cast<float>(m_height)) return;
+
+	const int32_t minX = (std::max)(0, static_cast<int32_t>(std::floor(minXf))) & ~3;
+	const int32_t maxX = (std::min)(static_cast<int32_t>(m_width) - 1, static_cast<int32_t>(maxXf));
+	const int32_t minY = (std::max)(0, static_cast<int32_t>(std::floor(minYf)));
+	const int32_t maxY = (std::min)(static_cast<int32_t>(m_height) - 1, static_cast<int32_t>(maxYf));
+
+	// 엣지 함수 E(p) = A * x + B * y + C (세 값이 모두 0 이상이면 삼각형 안)
+	// E0는 v1->v2 (v0의 가중치), E1은 v2->v0, E2는 v0->v1
+	const float a0 = v1.Y - v2.Y, b0 = v2.X - v1.X, c0 = -(a0 * v1.X + b0 * v1.Y);
+	const float a1 = v2.Y - v0.Y, b1 = v0.X - v2.X, c1 = -(a1 * v2.X + b1 * v2.Y);
+	const float a2 = v0.Y - v1.Y, b2 = v1.X - v0.X, c2 = -(a2 * v0.X + b2 * v0.Y);
+
+	// 깊이는 화면 공간에서 선형: z = (E0 * z0 + E1 * z1 + E2 * z2) / area
+	const float invArea = 1.0f / area;
+	const float za = (a0 * v0.Z + a1 * v1.Z + a2 * v2.Z) * invArea;
+	const float zb = (b0 * v0.Z + b1 * v1.Z + b2 * v2.Z) * invArea;
+	const float zc = (c0 * v0.Z + c1 * v1.Z + c2 * v2.Z) * invArea;
+
+	const __m128 pixelOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 stepE0 = _mm_set1_ps(4.0f * a0);
+	const __m128 stepE1 = _mm_set1_ps(4.0f * a1);
+	const __m128 stepE2 = _mm_set1_ps(4.0f * a2);
+	const __m128 stepZ = _mm_set1_ps(4.0f * za);
+
+	for (int32_t y = minY; y <= maxY; ++y)
+	{
+		const float py = static_cast<float>(y) + 0.5f;
+		const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(minX)), pixelOffsets);
+
+		__m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a0), px), _mm_set1_ps(b0 * py + c0));
+		__m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a1), px), _mm_set1_ps(b1 * py + c1));
+		__m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a2), px), _mm_set1_ps(b2 * py + c2));
+		__m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(za), px), _mm_set1_ps(zb * py + zc));
+
+		float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+		for (int32_t x = minX; x <= maxX; x += 4)
+		{
+			const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+			if (_mm_movemask_ps(inside))
+			{
+				const __m128 depth = _mm_loadu_ps(row + x);
+				const __m128 nearer = _mm_min_ps(depth, z);
+				_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, depth)));
+			}
+
+			e0 = _mm_add_ps(e0, stepE0);
+			e1 = _mm_add_ps(e1, stepE1);
+			e2 = _mm_add_ps(e2, stepE2);
+			z = _mm_add_ps(z, stepZ);
+		}
+	}
+
+	++m_rasterizedTriangles;
+}
+
+void OcclusionCuller::FinishOccluders()
+{
+	for (uint32_t ty = 0; ty < m_tilesY; ++ty)
+	{
+		for (uint32_t tx = 0; tx < m_tilesX; ++tx)
+		{
+			__m128 tileMax = _mm_setzero_ps();
+			for (uint32_t y = ty * TILE_SIZE; y < (ty + 1) * TILE_SIZE; ++y)
+			{
+				const float* row = m_depth.data() + static_cast<size_t>(y) * m_width + tx * TILE_SIZE;
+				tileMax = _mm_max_ps(tileMax, _mm_max_ps(_mm_loadu_ps(row), _mm_loadu_ps(row + 4)));
+			}
+
+			alignas(16) float lanes[4];
+			_mm_store_ps(lanes, tileMax);
+			m_tileMaxDepth[static_cast<size_t>(ty) * m_tilesX + tx] = (std::max)((std::max)(lanes[0], lanes[1]), (std::max)(lanes[2], lanes[3]));
+		}
+	}
+}
+
+bool OcclusionCuller::IsVisible(const XMFLOAT3& center, const XMFLOAT3& extents) const
+{
+	// 1. 8개 꼭짓점을 투영해 화면 사각형과 가장 가까운 깊이를 구합니다.
+	const MatrixRows viewProj = LoadRows(m_viewProjection);
+	const float halfWidth = 0.5f * static_cast<float>(m_width);
+	const float halfHeight = 0.5f * static_cast<float>(m_height);
+
+	float minX = static_cast<float>(m_width), maxX = -1.0f;
+	float minY = static_cast<float>(m_height), maxY = -1.0f;
+	float minZ = 1.0f;
+
+	for (int corner = 0; corner < 8; ++corner)
+	{
+		const float x = center.x + ((corner & 1) ? extents.x : -extents.x);
+		const float y = center.y + ((corner & 2) ? extents.y : -extents.y);
+		const float z = center.z + ((corner & 4) ? extents.z : -extents.z);
+
+		alignas(16) float clip[4];
+		_mm_store_ps(clip, TransformPoint(viewProj, x, y, z));
+
+		// 근평면에 걸치면 판단하지 않고 보이는 것으로 둡니다.
+		if (clip[3] <= MIN_CLIP_W || clip[2] < 0.0f) return true;
+
+		const float invW = 1.0f / clip[3];
+		const float sx = (clip[0] * invW + 1.0f) * halfWidth;
+		const float sy = (1.0f - clip[1] * invW) * halfHeight;
+
+		minX = (std::min)(minX, sx); maxX = (std::max)(maxX, sx);
+		minY = (std::min)(minY, sy); maxY = (std::max)(maxY, sy);
+		minZ = (std::min)(minZ, clip[2] * invW);
+	}
+
+	// 화면 밖 판단은 프러스텀 컬링의 몫입니다.
+	if (maxX < 0.0f || maxY < 0.0f || minX >= static_cast<float>(m_width) || minY >= static_cast<float>(m_height)) return true;
+
+	const int32_t x0 = (std::max)(0, static_cast<int32_t>(std::floor(minX)));
+	const int32_t x1 = (std::min)(static_cast<int32_t>(m_width) - 1, static_cast<int32_t>(maxX));
+	const int32_t y0 = (std::max)(0, static_cast<int32_t>(std::floor(minY)));
+	const int32_t y1 = (std::min)(static_cast<int32_t>(m_height) - 1, static_cast<int32_t>(maxY));
+
+	// 2. 타일 단위: 타일의 가장 먼 가리개 깊이보다도 멀면 그 타일은 통째로 가려져 있습니다.
+	const int32_t tileSize = static_cast<int32_t>(TILE_SIZE);
+	for (int32_t ty = y0 / tileSize; ty <= y1 / tileSize; ++ty)
+	{
+		for (int32_t tx = x0 / tileSize; tx <= x1 / tileSize; ++tx)
+		{
+			if (m_tileMaxDepth[static_cast<size_t>(ty) * m_tilesX + tx] < minZ) continue;
+
+			// 3. 픽셀 단위: 가리개가 박스보다 멀거나 없는(1.0) 픽셀이 하나라도 있으면 보입니다.
+			const int32_t py0 = (std::max)(y0, ty * tileSize), py1 = (std::min)(y1, ty * tileSize + tileSize - 1);
+			const int32_t px0 = (std::max)(x0, tx * tileSize), px1 = (std::min)(x1, tx * tileSize + tileSize - 1);
+			for (int32_t py = py0; py <= py1; ++py)
+			{
+				const float* row = m_depth.data() + static_cast<size_t>(py) * m_width;
+				for (int32_t px = px0; px <= px1; ++px)
+				{
+					if (row[px] >= minZ) return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+void OcclusionCuller::FilterVisible(const AabbStreams& boxes, const std::vector<uint32_t>& candidates,
+	std::vector<uint32_t>& outVisible, JobSystem* jobs) const
+{
+	// 병렬로 표시만 한 뒤, 입력 순서를 유지하면서 모읍니다.
+	std::vector<uint8_t> visible(candidates.size(), 0);
+
+	auto testRange = [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			const uint32_t index = candidates[i];
+			visible[i] = IsVisible(
+				{ boxes.CenterX[index], boxes.CenterY[index], boxes.CenterZ[index] },
+				{ boxes.ExtentX[index], boxes.ExtentY[index], boxes.ExtentZ[index] }) ? 1 : 0;
+		}
+	};
+
+	if (jobs) jobs->ParallelFor(candidates.size(), 64, testRange);
+	else testRange(0, candidates.size());
+
+	outVisible.clear();
+	for (size_t i = 0; i < candidates.size(); ++i)
+	{
+		if (visible[i]) outVisible.push_back(candidates[i]);
+	}
+}
@@ -0,0 +1,78 @@
+// OcclusionCuller.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+
+#include "Rendering/FrustumCulling.h" // AabbStreams
+
+class JobSystem;
+
+/*
+ * [OcclusionCuller]
+ * CPU 소프트웨어 오클루전 컬링입니다. (뷰마다 하나씩 소유)
+ *
+ * 1. BeginFrame: 작은 깊이 버퍼(기본 256x128)를 가장 먼 값(1.0)으로 지웁니다.
+ * 2. RasterizeOccluder: 가리개(Occluder)로 지정한 메쉬의 삼각형을 SSE로 4픽셀씩 래스터화해
+ *    픽셀마다 가장 가까운 깊이를 남깁니다. (근평면에 걸친 삼각형은 보수적으로 건너뜀)
+ * 3. FinishOccluders: 8x8 타일마다 '가장 먼 깊이(max)'를 모아 계층(Hi-Z)을 만듭니다.
+ * 4. IsVisible / FilterVisible: 바운딩 박스를 화면에 투영해 가장 가까운 깊이를 구하고,
+ *    덮는 타일의 max 깊이보다 멀면 그 타일은 통째로 가려진 것으로 보고,
+ *    아니면 그 타일의 픽셀까지 내려가 확인합니다. (테스트는 읽기 전용이라 워커 스레드에서 병렬 실행)
+ *
+ * 깊이는 D3D 규약(z/w, 0 = 가까움, 1 = 멂)입니다.
+ * Windows / D3D12에 의존하지 않으므로 헤드리스로 테스트할 수 있습니다.
+ */
+class OcclusionCuller
+{
+public:
+	static constexpr uint32_t TILE_SIZE = 8;
+
+	// 너비/높이는 TILE_SIZE의 배수로 올림합니다.
+	OcclusionCuller(uint32_t width = 256, uint32_t height = 128);
+
+	void BeginFrame(const DirectX::XMFLOAT4X4& viewProjection);
+
+	// positions: 첫 번째 위치 주소, stride: 정점 하나의 바이트 크기, indices: 삼각형 리스트
+	void RasterizeOccluder(const DirectX::XMFLOAT4X4& world,
+		const DirectX::XMFLOAT3* positions, size_t stride, size_t vertexCount,
+		const uint32_t* indices, size_t indexCount);
+
+	void FinishOccluders();
+
+	// 월드 공간 AABB (중심 + 반크기)가 가리개 뒤에 완전히 숨었으면 false
+	bool IsVisible(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents) const;
+
+	// candidates[i]번 박스 중 보이는 것만 outVisible에 (입력 순서대로) 씁니다.
+	// jobs가 있으면 워커 스레드에서 나눠 검사합니다.
+	void FilterVisible(const AabbStreams& boxes, const std::vector<uint32_t>& candidates,
+		std::vector<uint32_t>& outVisible, JobSystem* jobs = nullptr) const;
+
+	uint32_t GetWidth() const { return m_width; }
+	uint32_t GetHeight() const { return m_height; }
+	const std::vector<float>& GetDepthBuffer() const { return m_depth; } // 디버그 표시용
+	size_t GetRasterizedTriangleCount() const { return m_rasterizedTriangles; }
+
+private:
+	struct ScreenVertex
+	{
+		float X, Y, Z;
+		bool Valid; // 근평면 앞(w가 충분히 큼)에 있는지
+	};
+
+	void RasterizeTriangle(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2);
+
+	uint32_t m_width;
+	uint32_t m_height;
+	uint32_t m_tilesX;
+	uint32_t m_tilesY;
+
+	DirectX::XMFLOAT4X4 m_viewProjection = {};
+
+	std::vector<float> m_depth;       // 픽셀별 가장 가까운 가리개 깊이
+	std::vector<float> m_tileMaxDepth; // 타일별 가장 먼 깊이
+	std::vector<ScreenVertex> m_screenVertices; // RasterizeOccluder 재사용 버퍼
+	size_t m_rasterizedTriangles = 0;
+};
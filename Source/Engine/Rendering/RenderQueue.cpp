@@ -0,0 +1,266 @@
+// RenderQueue.cpp
+#include "Rendering/RenderQueue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	constexpr uint64_t Mask(uint32_t bits) { return (uint64_t(1) << bits) - 1; }
+
+	// 필드 위치 (LSB 기준 시프트)
+	constexpr uint32_t TRANSLUCENT_SHIFT = 64 - RenderSortKey::LAYER_BITS - RenderSortKey::PASS_BITS - 1;
+	constexpr uint32_t PASS_SHIFT = TRANSLUCENT_SHIFT + 1;
+	constexpr uint32_t LAYER_SHIFT = PASS_SHIFT + RenderSortKey::PASS_BITS;
+
+	// 상태 필드 (파이프라인/머티리얼/메쉬) 묶음의 폭. 불투명은 깊이 위에, 반투명은 맨 아래에 놓입니다.
+	constexpr uint32_t STATE_BITS = RenderSortKey::PIPELINE_BITS + RenderSortKey::MATERIAL_BITS + RenderSortKey::MESH_BITS;
+	static_assert(RenderSortKey::LAYER_BITS + RenderSortKey::PASS_BITS + 1 + STATE_BITS + RenderSortKey::DEPTH_BITS == 64,
+		"RenderSortKey fields must fill 64 bits");
+
+	uint64_t PackState(uint32_t pipeline, uint32_t material, uint32_t mesh)
+	{
+		return ((pipeline & Mask(RenderSortKey::PIPELINE_BITS)) << (RenderSortKey::MATERIAL_BITS + RenderSortKey::MESH_BITS))
+			| ((material & Mask(RenderSortKey::MATERIAL_BITS)) << RenderSortKey::MESH_BITS)
+			| (mesh & Mask(RenderSortKey::MESH_BITS));
+	}
+
+	uint64_t PackHeader(uint32_t layer, uint32_t pass, bool translucent)
+	{
+		return ((layer & Mask(RenderSortKey::LAYER_BITS)) << LAYER_SHIFT)
+			| ((pass & Mask(RenderSortKey::PASS_BITS)) << PASS_SHIFT)
+			| (uint64_t(translucent ? 1 : 0) << TRANSLUCENT_SHIFT);
+	}
+
+	// 키에서 상태 필드 묶음만 꺼냅니다.
+	uint64_t UnpackState(uint64_t key)
+	{
+		return RenderSortKey::IsTranslucent(key) ? (key & Mask(STATE_BITS)) : ((key >> RenderSortKey::DEPTH_BITS) & Mask(STATE_BITS));
+	}
+}
+
+uint32_t RenderSortKey::QuantizeDepth(float depth)
+{
+	if (!(depth > 0.0f)) return 0; // 음수/NaN은 가장 앞으로
+
+	uint32_t bits;
+	memcpy(&bits, &depth, sizeof(bits));
+	return bits >> (32 - 1 - DEPTH_BITS); // 부호 비트(항상 0)를 뺀 상위 24비트
+}
+
+uint64_t RenderSortKey::MakeOpaque(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth)
+{
+	return PackHeader(layer, pass, false)
+		| (PackState(pipeline, material, mesh) << DEPTH_BITS)
+		| QuantizeDepth(depth);
+}
+
+uint64_t RenderSortKey::MakeTranslucent(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth)
+{
+	const uint64_t farToNear = Mask(DEPTH_BITS) - QuantizeDepth(depth);
+	return PackHeader(layer, pass, true)
+		| (farToNear << STATE_BITS)
+		| PackState(pipeline, material, mesh);
+}
+
+uint64_t RenderSortKey::GetStateBits(uint64_t key)
+{
+	return IsTranslucent(key) ? key : (key >> DEPTH_BITS);
+}
+
+bool RenderSortKey::IsTranslucent(uint64_t key)
+{
+	return ((key >> TRANSLUCENT_SHIFT) & 1) != 0;
+}
+
+uint32_t RenderSortKey::GetPipeline(uint64_t key)
+{
+	return static_cast<uint32_t>((UnpackState(key) >> (MATERIAL_BITS + MESH_BITS)) & Mask(PIPELINE_BITS));
+}
+
+uint32_t RenderSortKey::GetMaterial(uint64_t key)
+{
+	return static_cast<uint32_t>((UnpackState(key) >> MESH_BITS) & Mask(MATERIAL_BITS));
+}
+
+uint32_t RenderSortKey::GetMesh(uint64_t key)
+{
+	return static_cast<uint32_t>(UnpackState(key) & Mask(MESH_BITS));
+}
+
+void RenderQueue::Sort()
+{
+	const size_t count = m_packets.size();
+	if (count < 2) return;
+
+	// 1. 바이트 자리 8개의 히스토그램을 한 번의 순회로 만듭니다.
+	constexpr uint32_t RADIX = 256;
+	constexpr uint32_t PASS_COUNT = 8;
+	uint32_t histograms[PASS_COUNT][RADIX] = {};
+
+	for (const RenderPacket& packet : m_packets)
+	{
+		uint64_t key = packet.Key;
+		for (uint32_t pass = 0; pass < PASS_COUNT; ++pass)
+		{
+			++histograms[pass][key & 0xFF];
+			key >>= 8;
+		}
+	}
+
+	// 2. 낮은 바이트부터 안정 분배. 모든 키의 해당 바이트가 같으면 순서가 바뀌지 않으므로 건너뜁니다.
+	m_scratch.resize(count);
+	RenderPacket* source = m_packets.data();
+	RenderPacket* destination = m_scratch.data();
+
+	for (uint32_t pass = 0; pass < PASS_COUNT; ++pass)
+	{
+		uint32_t* histogram = histograms[pass];
+		const uint32_t shift = pass * 8;
+
+		if (histogram[(source[0].Key >> shift) & 0xFF] == count) continue;
+
+		uint32_t offset = 0;
+		for (uint32_t bucket = 0; bucket < RADIX; ++bucket)
+		{
+			const uint32_t bucketCount = histogram[bucket];
+			histogram[bucket] = offset;
+			offset += bucketCount;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const RenderPacket& packet = source[i];
+			destination[histogram[(packet.Key >> shift) & 0xFF]++] = packet;
+		}
+
+		std::swap(source, destination);
+	}
+
+	// 홀수 번 분배했다면 결과가 scratch 쪽에 있습니다.
+	if (source != m_packets.data())
+	{
+		m_packets.swap(m_scratch);
+	}
+}
+
+RenderQueue::BenchmarkResult RenderQueue::RunBenchmark(size_t count, uint32_t iterations)
+{
+	BenchmarkResult result;
+	result.Count = count;
+	if (count == 0 || iterations == 0) return result;
+
+	// 재현 가능한 의사 난수 (LCG). 실제 장면처럼 파이프라인/머티리얼 수는 적고 깊이는 제각각입니다.
+	uint32_t seed = 12345u;
+	auto random = [&seed](uint32_t range)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return (seed >> 8) % range;
+	};
+
+	std::vector<RenderPacket> input(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float depth = static_cast<float>(random(100000)) * 0.01f;
+		input[i].Key = RenderSortKey::MakeOpaque(0, 0, random(8), random(64), random(4), depth);
+		input[i].Index = static_cast<uint32_t>(i);
+	}
+
+	using Clock = std::chrono::steady_clock;
+
+	RenderQueue queue;
+	queue.Reserve(count);
+	double radixTotal = 0.0;
+	for (uint32_t n = 0; n < iterations; ++n)
+	{
+		queue.m_packets.assign(input.begin(), input.end());
+		const auto start = Clock::now();
+		queue.Sort();
+		radixTotal += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+	result.RadixMs = radixTotal / iterations;
+
+	std::vector<RenderPacket> reference;
+	double stdSortTotal = 0.0;
+	for (uint32_t n = 0; n < iterations; ++n)
+	{
+		reference.assign(input.begin(), input.end());
+		const auto start = Clock::now();
+		std::stable_sort(reference.begin(), reference.end(),
+			[](const RenderPacket& a, const RenderPacket& b) { return a.Key < b.Key; });
+		stdSortTotal += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+	result.StdSortMs = stdSortTotal / iterations;
+
+	result.Matches = std::equal(reference.begin(), reference.end(), queue.m_packets.begin(),
+		[](const RenderPacket& a, const RenderPacket& b) { return a.Key == b.Key && a.Index == b.Index; });
+
+	return result;
+}
+
+void RenderStateCache::Invalidate()
+{
+	m_pipelineValid = false;
+	m_topologyValid = false;
+	m_vertexBufferValid = false;
+	m_indexBufferValid = false;
+}
+
+void RenderStateCache::SetPipeline(const RHIPipeline* pipeline)
+{
+	if (m_pipelineValid && m_pipeline == pipeline)
+	{
+		++m_elidedCount;
+		return;
+	}
+
+	m_pipeline = pipeline;
+	m_pipelineValid = true;
+	++m_issuedCount;
+	m_commandList.SetPipeline(pipeline);
+}
+
+void RenderStateCache::SetPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	if (m_topologyValid && m_topology == topology)
+	{
+		++m_elidedCount;
+		return;
+	}
+
+	m_topology = topology;
+	m_topologyValid = true;
+	++m_issuedCount;
+	m_commandList.SetPrimitiveTopology(topology);
+}
+
+void RenderStateCache::SetVertexBuffer(const RHIBuffer* buffer, uint32_t stride)
+{
+	if (m_vertexBufferValid && m_vertexBuffer == buffer && m_vertexStride == stride)
+	{
+		++m_elidedCount;
+		return;
+	}
+
+	m_vertexBuffer = buffer;
+	m_vertexStride = stride;
+	m_vertexBufferValid = true;
+	++m_issuedCount;
+	m_commandList.SetVertexBuffer(0, buffer, stride);
+}
+
+void RenderStateCache::SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format)
+{
+	if (m_indexBufferValid && m_indexBuffer == buffer && m_indexFormat == format)
+	{
+		++m_elidedCount;
+		return;
+	}
+
+	m_indexBuffer = buffer;
+	m_indexFormat = format;
+	m_indexBufferValid = true;
+	++m_issuedCount;
+	m_commandList.SetIndexBuffer(buffer, format);
+}
@@ -0,0 +1,130 @@
+// RenderQueue.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "RHI/RHI.h"
+
+/*
+ * [RenderSortKey]
+ * 드로우 패킷의 64비트 정렬 키입니다. 정수 하나로 비교하므로 정렬이 싸고, 상위 비트일수록 우선합니다.
+ *
+ *   불투명: [레이어 4][패스 4][0][파이프라인 11][머티리얼 12][메쉬 8][깊이 24]
+ *   반투명: [레이어 4][패스 4][1][깊이 24 (반전)][파이프라인 11][머티리얼 12][메쉬 8]
+ *
+ * - 불투명은 상태(파이프라인 -> 머티리얼 -> 메쉬)로 먼저 모아 상태 전환을 줄이고, 같은 상태 안에서는 앞에서 뒤로 그립니다.
+ * - 반투명은 블렌딩 결과가 순서에 의존하므로 깊이가 상태보다 우선이며, 뒤에서 앞으로 그립니다.
+ * - 반투명 비트가 패스 아래에 있으므로 같은 패스 안에서 불투명이 항상 먼저 나옵니다.
+ * 각 필드는 폭을 넘는 값을 잘라 넣으니 호출자가 ID를 필드 폭 안에서 관리해야 합니다.
+ */
+namespace RenderSortKey
+{
+	constexpr uint32_t LAYER_BITS = 4;
+	constexpr uint32_t PASS_BITS = 4;
+	constexpr uint32_t PIPELINE_BITS = 11;
+	constexpr uint32_t MATERIAL_BITS = 12;
+	constexpr uint32_t MESH_BITS = 8;
+	constexpr uint32_t DEPTH_BITS = 24;
+
+	// 뷰 공간 깊이(0 이상)를 24비트로 양자화합니다. 양수 float의 비트 패턴은 값과 같은 순서이므로 상위 비트만 씁니다.
+	uint32_t QuantizeDepth(float depth);
+
+	uint64_t MakeOpaque(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth);
+	uint64_t MakeTranslucent(uint32_t layer, uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth);
+
+	// 깊이를 뺀 '상태' 부분. 같으면 같은 파이프라인/머티리얼/메쉬이므로 인스턴스 묶음으로 합칠 수 있습니다.
+	// (반투명은 깊이가 상태보다 위에 있으므로 깊이까지 같아야 같은 값이 됩니다.)
+	uint64_t GetStateBits(uint64_t key);
+
+	bool IsTranslucent(uint64_t key);
+	uint32_t GetPipeline(uint64_t key);
+	uint32_t GetMaterial(uint64_t key);
+	uint32_t GetMesh(uint64_t key);
+}
+
+// 큐의 원소. Index는 호출자 쪽 데이터(드로우 아이템 배열 등)의 위치입니다.
+struct RenderPacket
+{
+	uint64_t Key = 0;
+	uint32_t Index = 0;
+};
+
+/*
+ * [RenderQueue]
+ * 한 뷰의 드로우 패킷을 모아 키 순서로 정렬합니다.
+ * - 정렬은 8비트씩 8번 도는 LSD 기수 정렬(안정)이며, 히스토그램 8개를 한 번에 만듭니다.
+ * - 모든 키에서 같은 바이트(예: 쓰지 않는 레이어/패스 필드)는 분배 단계를 건너뜁니다.
+ * - 버퍼는 프레임 간에 재사용하므로 Clear 후 Push해도 재할당이 없습니다.
+ */
+class RenderQueue
+{
+public:
+	void Clear() { m_packets.clear(); }
+	void Reserve(size_t count) { m_packets.reserve(count); }
+	void Push(uint64_t key, uint32_t index) { m_packets.push_back({ key, index }); }
+
+	void Sort();
+
+	const std::vector<RenderPacket>& GetPackets() const { return m_packets; }
+	size_t GetCount() const { return m_packets.size(); }
+	bool IsEmpty() const { return m_packets.empty(); }
+
+	// 마이크로 벤치마크 결과 (기수 정렬 vs std::sort)
+	struct BenchmarkResult
+	{
+		size_t Count = 0;
+		double RadixMs = 0.0;    // 반복 1회당 평균 (ms)
+		double StdSortMs = 0.0;  // 반복 1회당 평균 (ms)
+		bool Matches = false;    // 두 결과가 같은 순서인지
+	};
+
+	static BenchmarkResult RunBenchmark(size_t count, uint32_t iterations);
+
+private:
+	std::vector<RenderPacket> m_packets;
+	std::vector<RenderPacket> m_scratch;
+};
+
+/*
+ * [RenderStateCache]
+ * RHI 커맨드 리스트 앞에 두고 직전과 같은 상태 설정을 걸러냅니다.
+ * 정렬된 큐를 순서대로 기록하면 같은 파이프라인/버퍼가 연속으로 나오므로 대부분의 설정이 빠집니다.
+ * 커맨드 리스트를 다른 곳에서 직접 건드렸다면 Invalidate()로 기억을 지워야 합니다.
+ */
+class RenderStateCache
+{
+public:
+	explicit RenderStateCache(RHICommandList& commandList) : m_commandList(commandList) {}
+
+	void Invalidate();
+
+	void SetPipeline(const RHIPipeline* pipeline);
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology);
+	void SetVertexBuffer(const RHIBuffer* buffer, uint32_t stride); // 슬롯 0, 오프셋 0
+	void SetIndexBuffer(const RHIBuffer* buffer, RHIFormat format);
+
+	RHICommandList& GetCommandList() const { return m_commandList; }
+
+	uint32_t GetIssuedCount() const { return m_issuedCount; }
+	uint32_t GetElidedCount() const { return m_elidedCount; }
+
+private:
+	RHICommandList& m_commandList;
+
+	const RHIPipeline* m_pipeline = nullptr;
+	RHIPrimitiveTopology m_topology = RHIPrimitiveTopology::TriangleList;
+	const RHIBuffer* m_vertexBuffer = nullptr;
+	uint32_t m_vertexStride = 0;
+	const RHIBuffer* m_indexBuffer = nullptr;
+	RHIFormat m_indexFormat = RHIFormat::Unknown;
+
+	bool m_pipelineValid = false;
+	bool m_topologyValid = false;
+	bool m_vertexBufferValid = false;
+	bool m_indexBufferValid = false;
+
+	uint32_t m_issuedCount = 0;
+	uint32_t m_elidedCount = 0;
+};
@@ -0,0 +1,106 @@
+#include "VisibilityCache.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "Components/Camera.h" // CameraViewData
+
+using namespace DirectX;
+
+bool VisibilityCache::BeginFrame(const CameraViewData& view, uint64_t sceneStamp)
+{
+	++m_frame;
+	m_touchedCount = 0;
+	m_frameStats = {};
+
+	if (m_hasReference && sceneStamp == m_referenceStamp && IsNearReference(view))
+	{
+		return true;
+	}
+
+	// 기준 자세를 지금 카메라로 다시 잡습니다. (View 행렬의 열 = 카메라 축)
+	m_hasReference = true;
+	m_referenceStamp = sceneStamp;
+	m_referencePosition = { view.Position.x, view.Position.y, view.Position.z };
+	m_referenceForward = { view.View._13, view.View._23, view.View._33 };
+	m_referenceUp = { view.View._12, view.View._22, view.View._32 };
+	m_referenceProjection = view.Projection;
+
+	m_entries.clear();
+	++m_frameStats.FullRefreshes;
+	++m_totalStats.FullRefreshes;
+
+	return false;
+}
+
+bool VisibilityCache::TryGet(const void* key, uint32_t version, bool& outVisible)
+{
+	++m_frameStats.Lookups;
+	++m_totalStats.Lookups;
+
+	auto it = m_entries.find(key);
+	if (it == m_entries.end() || it->second.Version != version)
+	{
+		return false;
+	}
+
+	// 버전이 다른 항목은 곧 Store로 덮이므로 여기서는 일치할 때만 표시합니다.
+	if (it->second.Frame != m_frame)
+	{
+		it->second.Frame = m_frame;
+		++m_touchedCount;
+	}
+
+	++m_frameStats.Hits;
+	++m_totalStats.Hits;
+	outVisible = it->second.Visible;
+	return true;
+}
+
+void VisibilityCache::Store(const void* key, uint32_t version, bool visible)
+{
+	auto [it, inserted] = m_entries.try_emplace(key);
+	if (inserted || it->second.Frame != m_frame)
+	{
+		++m_touchedCount;
+	}
+
+	it->second.Version = version;
+	it->second.Frame = m_frame;
+	it->second.Visible = visible;
+}
+
+void VisibilityCache::EndFrame()
+{
+	// 모든 항목이 이번 프레임에 쓰였으면 훑을 필요가 없습니다.
+	if (m_touchedCount == m_entries.size()) return;
+
+	for (auto it = m_entries.begin(); it != m_entries.end();)
+	{
+		if (it->second.Frame != m_frame) it = m_entries.erase(it);
+		else ++it;
+	}
+}
+
+bool VisibilityCache::IsNearReference(const CameraViewData& view) const
+{
+	if (std::memcmp(&view.Projection, &m_referenceProjection, sizeof(XMFLOAT4X4)) != 0)
+	{
+		return false;
+	}
+
+	const float dx = view.Position.x - m_referencePosition.x;
+	const float dy = view.Position.y - m_referencePosition.y;
+	const float dz = view.Position.z - m_referencePosition.z;
+	if (dx * dx + dy * dy + dz * dz > m_settings.MaxTranslation * m_settings.MaxTranslation)
+	{
+		return false;
+	}
+
+	// 앞/위 축이 모두 허용 각도 안에 있어야 합니다. (두 축이면 롤까지 잡힘)
+	const float minCos = std::cos(XMConvertToRadians(m_settings.MaxRotationDegrees));
+	const float forwardCos = view.View._13 * m_referenceForward.x + view.View._23 * m_referenceForward.y + view.View._33 * m_referenceForward.z;
+	const float upCos = view.View._12 * m_referenceUp.x + view.View._22 * m_referenceUp.y + view.View._32 * m_referenceUp.z;
+
+	return forwardCos >= minCos && upCos >= minCos;
+}
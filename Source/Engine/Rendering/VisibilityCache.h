@@ -0,0 +1,96 @@
+// VisibilityCache.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <DirectXMath.h>
+
+struct CameraViewData;
+
+/*
+ * [VisibilityCache]
+ * 오브젝트별 가시성 결과를 프레임 사이에 재사용하는 캐시입니다. (뷰마다 하나씩 소유)
+ * 지난 프레임에 보이던(또는 가려지던) 오브젝트는 대부분 이번 프레임에도 그대로라는 점을 이용합니다.
+ *
+ * 재사용 정책 (보수적):
+ * - 기준 자세: 마지막으로 '전체 재검사'를 한 시점의 카메라 위치/방향/투영입니다.
+ *   카메라가 기준 자세에서 임계값 이상 벗어나거나 투영이 바뀌면 캐시를 모두 버립니다.
+ *   (매 프레임의 작은 이동이 쌓여도 '기준'과 비교하므로 오차가 임계값을 넘지 않습니다.)
+ * - 정적 오브젝트: 기록할 때의 Transform 버전과 같으면 검사 없이 지난 결과를 씁니다.
+ * - 움직인 오브젝트 / 새 오브젝트: 버전이 다르거나 항목이 없으므로 다시 검사합니다.
+ * - sceneStamp: 결과 전체에 영향을 주는 값(가리개 이동, 오브젝트 파괴 등)을 호출자가 묶어 넘깁니다.
+ *   값이 바뀌면 캐시를 모두 버립니다.
+ *
+ * 키는 오브젝트 주소이며, 한 프레임 동안 조회/기록되지 않은 항목은 EndFrame에서 지웁니다.
+ * 스레드 안전하지 않습니다. (뷰 하나는 한 스레드에서만 다룹니다)
+ */
+class VisibilityCache
+{
+public:
+	struct Settings
+	{
+		float MaxTranslation = 0.05f;    // 기준 위치에서 허용하는 이동 거리 (월드 단위)
+		float MaxRotationDegrees = 0.5f; // 기준 방향에서 허용하는 회전 각도
+	};
+
+	struct Stats
+	{
+		uint64_t Lookups = 0;       // TryGet 호출 수
+		uint64_t Hits = 0;          // 검사 없이 재사용한 수
+		uint64_t FullRefreshes = 0; // 캐시를 모두 버리고 다시 검사한 프레임 수
+
+		float GetHitRate() const { return (Lookups > 0) ? static_cast<float>(Hits) / static_cast<float>(Lookups) : 0.0f; }
+	};
+
+	VisibilityCache() = default;
+	explicit VisibilityCache(const Settings& settings) : m_settings(settings) {}
+
+	// 재사용이 허용되면 true, 기준 자세를 새로 잡고 캐시를 비웠으면 false (전체 재검사)
+	bool BeginFrame(const CameraViewData& view, uint64_t sceneStamp);
+
+	// 재사용할 수 있으면 outVisible에 지난 결과를 쓰고 true
+	bool TryGet(const void* key, uint32_t version, bool& outVisible);
+
+	void Store(const void* key, uint32_t version, bool visible);
+
+	// 이번 프레임에 조회/기록되지 않은 항목(사라진 오브젝트)을 지웁니다.
+	void EndFrame();
+
+	// 다음 BeginFrame에서 전체 재검사를 강제합니다.
+	void Invalidate() { m_hasReference = false; }
+
+	void SetSettings(const Settings& settings) { m_settings = settings; Invalidate(); }
+	const Settings& GetSettings() const { return m_settings; }
+
+	const Stats& GetFrameStats() const { return m_frameStats; } // 마지막 프레임
+	const Stats& GetTotalStats() const { return m_totalStats; } // ResetStats 이후 누적
+	void ResetStats() { m_totalStats = {}; }
+
+	size_t GetEntryCount() const { return m_entries.size(); }
+
+private:
+	struct Entry
+	{
+		uint32_t Version = 0;
+		uint32_t Frame = 0;  // 마지막으로 조회/기록된 프레임
+		bool Visible = false;
+	};
+
+	bool IsNearReference(const CameraViewData& view) const;
+
+	Settings m_settings;
+	std::unordered_map<const void*, Entry> m_entries;
+
+	bool m_hasReference = false;
+	DirectX::XMFLOAT3 m_referencePosition = {};
+	DirectX::XMFLOAT3 m_referenceForward = {};
+	DirectX::XMFLOAT3 m_referenceUp = {};
+	DirectX::XMFLOAT4X4 m_referenceProjection = {};
+	uint64_t m_referenceStamp = 0;
+
+	uint32_t m_frame = 0;
+	size_t m_touchedCount = 0; // 이번 프레임에 조회/기록된 항목 수
+	Stats m_frameStats;
+	Stats m_totalStats;
+};
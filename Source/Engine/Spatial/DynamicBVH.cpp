@@ -0,0 +1,374 @@
+#include "DynamicBVH.h"
+
+#include <cassert>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+	inline XMFLOAT3 Min3(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		return { (std::min)(a.x, b.x), (std::min)(a.y, b.y), (std::min)(a.z, b.z) };
+	}
+
+	inline XMFLOAT3 Max3(const XMFLOAT3& a, const XMFLOAT3& b)
+	{
+		return { (std::max)(a.x, b.x), (std::max)(a.y, b.y), (std::max)(a.z, b.z) };
+	}
+}
+
+DynamicBVH::DynamicBVH(float margin, float displacementMultiplier)
+	: m_margin(margin), m_displacementMultiplier(displacementMultiplier)
+{
+}
+
+int32_t DynamicBVH::CreateProxy(const Aabb& box, void* userData)
+{
+	const int32_t proxyId = AllocateNode();
+	Node& node = m_nodes[proxyId];
+
+	node.Min = { box.Center.x - box.Extents.x - m_margin, box.Center.y - box.Extents.y - m_margin, box.Center.z - box.Extents.z - m_margin };
+	node.Max = { box.Center.x + box.Extents.x + m_margin, box.Center.y + box.Extents.y + m_margin, box.Center.z + box.Extents.z + m_margin };
+	node.UserData = userData;
+	node.Height = 0;
+
+	InsertLeaf(proxyId);
+	++m_proxyCount;
+
+	return proxyId;
+}
+
+void DynamicBVH::DestroyProxy(int32_t proxyId)
+{
+	assert(0 <= proxyId && proxyId < static_cast<int32_t>(m_nodes.size()));
+	assert(m_nodes[proxyId].IsLeaf());
+
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	--m_proxyCount;
+}
+
+bool DynamicBVH::MoveProxy(int32_t proxyId, const Aabb& box, const XMFLOAT3& displacement)
+{
+	assert(0 <= proxyId && proxyId < static_cast<int32_t>(m_nodes.size()));
+	assert(m_nodes[proxyId].IsLeaf());
+
+	const XMFLOAT3 tightMin = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+	const XMFLOAT3 tightMax = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+
+	// 아직 Fat AABB 안이면 리핏할 필요가 없습니다.
+	if (Contains(m_nodes[proxyId], tightMin, tightMax))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxyId);
+
+	// 여유를 두고, 움직이는 방향으로 더 늘려 다음 몇 프레임의 이동을 미리 흡수합니다.
+	Node& node = m_nodes[proxyId];
+	node.Min = { tightMin.x - m_margin, tightMin.y - m_margin, tightMin.z - m_margin };
+	node.Max = { tightMax.x + m_margin, tightMax.y + m_margin, tightMax.z + m_margin };
+
+	const XMFLOAT3 d = { displacement.x * m_displacementMultiplier, displacement.y * m_displacementMultiplier, displacement.z * m_displacementMultiplier };
+	if (d.x < 0.0f) node.Min.x += d.x; else node.Max.x += d.x;
+	if (d.y < 0.0f) node.Min.y += d.y; else node.Max.y += d.y;
+	if (d.z < 0.0f) node.Min.z += d.z; else node.Max.z += d.z;
+
+	InsertLeaf(proxyId);
+	return true;
+}
+
+Aabb DynamicBVH::GetFatAabb(int32_t proxyId) const
+{
+	const Node& node = m_nodes[proxyId];
+
+	Aabb box;
+	box.Center = { (node.Min.x + node.Max.x) * 0.5f, (node.Min.y + node.Max.y) * 0.5f, (node.Min.z + node.Max.z) * 0.5f };
+	box.Extents = { (node.Max.x - node.Min.x) * 0.5f, (node.Max.y - node.Min.y) * 0.5f, (node.Max.z - node.Min.z) * 0.5f };
+	return box;
+}
+
+int32_t DynamicBVH::AllocateNode()
+{
+	// 빈 노드가 없으면 배열을 늘립니다. (노드는 인덱스로 참조하므로 재할당되어도 안전합니다)
+	if (m_freeList == NULL_NODE)
+	{
+		m_nodes.emplace_back();
+		return static_cast<int32_t>(m_nodes.size() - 1);
+	}
+
+	const int32_t nodeId = m_freeList;
+	m_freeList = m_nodes[nodeId].Parent;
+	m_nodes[nodeId] = Node{};
+	return nodeId;
+}
+
+void DynamicBVH::FreeNode(int32_t nodeId)
+{
+	Node& node = m_nodes[nodeId];
+	node.Parent = m_freeList;
+	node.Child1 = NULL_NODE;
+	node.Child2 = NULL_NODE;
+	node.Height = -1;
+	node.UserData = nullptr;
+	m_freeList = nodeId;
+}
+
+void DynamicBVH::InsertLeaf(int32_t leaf)
+{
+	if (m_root == NULL_NODE)
+	{
+		m_root = leaf;
+		m_nodes[m_root].Parent = NULL_NODE;
+		return;
+	}
+
+	// 1. 최적의 형제 찾기 (표면적 휴리스틱)
+	const XMFLOAT3 leafMin = m_nodes[leaf].Min;
+	const XMFLOAT3 leafMax = m_nodes[leaf].Max;
+
+	int32_t index = m_root;
+	while (!m_nodes[index].IsLeaf())
+	{
+		const Node& node = m_nodes[index];
+		const int32_t child1 = node.Child1;
+		const int32_t child2 = node.Child2;
+
+		const float area = SurfaceArea(node.Min, node.Max);
+		const float combinedArea = SurfaceArea(Min3(node.Min, leafMin), Max3(node.Max, leafMax));
+
+		// 이 노드와 새 리프를 묶어 새 부모를 만드는 비용
+		const float cost = 2.0f * combinedArea;
+
+		// 리프를 더 아래로 내려보낼 때 조상들이 늘어나는 최소 비용
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto descendCost = [&](int32_t childId)
+		{
+			const Node& child = m_nodes[childId];
+			const float newArea = SurfaceArea(Min3(child.Min, leafMin), Max3(child.Max, leafMax));
+			return child.IsLeaf() ? (newArea + inheritanceCost)
+				: (newArea - SurfaceArea(child.Min, child.Max) + inheritanceCost);
+		};
+
+		const float cost1 = descendCost(child1);
+		const float cost2 = descendCost(child2);
+
+		if (cost < cost1 && cost < cost2) break;
+
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+
+	const int32_t sibling = index;
+
+	// 2. 새 부모 노드를 만들어 형제와 리프를 자식으로 붙입니다.
+	const int32_t oldParent = m_nodes[sibling].Parent;
+	const int32_t newParent = AllocateNode();
+	m_nodes[newParent].Parent = oldParent;
+	m_nodes[newParent].Min = Min3(leafMin, m_nodes[sibling].Min);
+	m_nodes[newParent].Max = Max3(leafMax, m_nodes[sibling].Max);
+	m_nodes[newParent].Height = m_nodes[sibling].Height + 1;
+	m_nodes[newParent].Child1 = sibling;
+	m_nodes[newParent].Child2 = leaf;
+	m_nodes[sibling].Parent = newParent;
+	m_nodes[leaf].Parent = newParent;
+
+	if (oldParent == NULL_NODE)
+	{
+		m_root = newParent;
+	}
+	else if (m_nodes[oldParent].Child1 == sibling)
+	{
+		m_nodes[oldParent].Child1 = newParent;
+	}
+	else
+	{
+		m_nodes[oldParent].Child2 = newParent;
+	}
+
+	// 3. 위로 올라가며 AABB/높이를 고치고 균형을 맞춥니다.
+	RefitAncestors(m_nodes[leaf].Parent);
+}
+
+void DynamicBVH::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == m_root)
+	{
+		m_root = NULL_NODE;
+		return;
+	}
+
+	const int32_t parent = m_nodes[leaf].Parent;
+	const int32_t grandParent = m_nodes[parent].Parent;
+	const int32_t sibling = (m_nodes[parent].Child1 == leaf) ? m_nodes[parent].Child2 : m_nodes[parent].Child1;
+
+	// 부모를 없애고 형제를 조부모에 직접 연결합니다.
+	if (grandParent == NULL_NODE)
+	{
+		m_root = sibling;
+		m_nodes[sibling].Parent = NULL_NODE;
+		FreeNode(parent);
+		return;
+	}
+
+	if (m_nodes[grandParent].Child1 == parent)
+	{
+		m_nodes[grandParent].Child1 = sibling;
+	}
+	else
+	{
+		m_nodes[grandParent].Child2 = sibling;
+	}
+	m_nodes[sibling].Parent = grandParent;
+	FreeNode(parent);
+
+	RefitAncestors(grandParent);
+}
+
+void DynamicBVH::RefitAncestors(int32_t nodeId)
+{
+	int32_t index = nodeId;
+	while (index != NULL_NODE)
+	{
+		index = Balance(index);
+
+		Node& node = m_nodes[index];
+		const Node& child1 = m_nodes[node.Child1];
+		const Node& child2 = m_nodes[node.Child2];
+
+		node.Height = 1 + (std::max)(child1.Height, child2.Height);
+		node.Min = Min3(child1.Min, child2.Min);
+		node.Max = Max3(child1.Max, child2.Max);
+
+		index = node.Parent;
+	}
+}
+
+/*
+ * 노드 A의 두 자식 높이 차이가 1보다 크면, 높은 쪽 자식을 A 자리로 끌어올리는 회전을 합니다.
+ *
+ *         A                 C
+ *       /   \             /   \
+ *      B     C    ->     A     F (더 높은 손자)
+ *           / \         / \
+ *          F   G       B   G
+ *
+ * 새 서브트리의 루트 인덱스를 반환합니다.
+ */
+int32_t DynamicBVH::Balance(int32_t iA)
+{
+	Node& A = m_nodes[iA];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return iA;
+	}
+
+	const int32_t iB = A.Child1;
+	const int32_t iC = A.Child2;
+	Node& B = m_nodes[iB];
+	Node& C = m_nodes[iC];
+
+	const int32_t balance = C.Height - B.Height;
+
+	// 오른쪽(C)을 끌어올리기 / 왼쪽(B)을 끌어올리기는 대칭이므로 한 함수로 처리합니다.
+	auto rotateUp = [&](int32_t iUp, int32_t iOther)
+	{
+		Node& up = m_nodes[iUp];
+		Node& other = m_nodes[iOther];
+		const int32_t iF = up.Child1;
+		const int32_t iG = up.Child2;
+		Node& F = m_nodes[iF];
+		Node& G = m_nodes[iG];
+
+		// up을 A 자리로
+		up.Child1 = iA;
+		up.Parent = A.Parent;
+		A.Parent = iUp;
+
+		if (up.Parent != NULL_NODE)
+		{
+			if (m_nodes[up.Parent].Child1 == iA) m_nodes[up.Parent].Child1 = iUp;
+			else m_nodes[up.Parent].Child2 = iUp;
+		}
+		else
+		{
+			m_root = iUp;
+		}
+
+		// 더 높은 손자는 up 아래에 남기고, 낮은 손자는 A가 가져갑니다.
+		const bool keepF = F.Height > G.Height;
+		const int32_t iKeep = keepF ? iF : iG;
+		const int32_t iMove = keepF ? iG : iF;
+		Node& moved = m_nodes[iMove];
+		const Node& kept = m_nodes[iKeep];
+
+		up.Child2 = iKeep;
+		if (A.Child1 == iUp) A.Child1 = iMove; else A.Child2 = iMove;
+		moved.Parent = iA;
+
+		A.Min = Min3(other.Min, moved.Min);
+		A.Max = Max3(other.Max, moved.Max);
+		A.Height = 1 + (std::max)(other.Height, moved.Height);
+
+		up.Min = Min3(A.Min, kept.Min);
+		up.Max = Max3(A.Max, kept.Max);
+		up.Height = 1 + (std::max)(A.Height, kept.Height);
+	};
+
+	if (balance > 1)
+	{
+		rotateUp(iC, iB);
+		return iC;
+	}
+
+	if (balance < -1)
+	{
+		rotateUp(iB, iC);
+		return iB;
+	}
+
+	return iA;
+}
+
+bool DynamicBVH::Validate() const
+{
+	if (m_root == NULL_NODE)
+	{
+		return m_proxyCount == 0;
+	}
+
+	return m_nodes[m_root].Parent == NULL_NODE && ValidateNode(m_root);
+}
+
+bool DynamicBVH::ValidateNode(int32_t nodeId) const
+{
+	const Node& node = m_nodes[nodeId];
+	if (node.IsLeaf())
+	{
+		return node.Child2 == NULL_NODE && node.Height == 0;
+	}
+
+	const Node& child1 = m_nodes[node.Child1];
+	const Node& child2 = m_nodes[node.Child2];
+
+	if (child1.Parent != nodeId || child2.Parent != nodeId) return false;
+	if (node.Height != 1 + (std::max)(child1.Height, child2.Height)) return false;
+	if (!Contains(node, child1.Min, child1.Max) || !Contains(node, child2.Min, child2.Max)) return false;
+
+	return ValidateNode(node.Child1) && ValidateNode(node.Child2);
+}
+
+float DynamicBVH::SurfaceArea(const XMFLOAT3& min, const XMFLOAT3& max)
+{
+	const float dx = max.x - min.x;
+	const float dy = max.y - min.y;
+	const float dz = max.z - min.z;
+	return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+bool DynamicBVH::Contains(const Node& outer, const XMFLOAT3& min, const XMFLOAT3& max)
+{
+	return outer.Min.x <= min.x && outer.Min.y <= min.y && outer.Min.z <= min.z &&
+		max.x <= outer.Max.x && max.y <= outer.Max.y && max.z <= outer.Max.z;
+}
@@ -0,0 +1,336 @@
+// DynamicBVH.h
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+#include <xmmintrin.h>
+
+#include "Math/Bounds.h"
+#include "Spatial/RayPacket.h"
+
+/*
+ * [DynamicBVH]
+ * 월드 공간 AABB들에 대한 증분(Incremental) 동적 AABB 트리입니다.
+ * - 리프(프록시)는 실제 AABB보다 조금 큰 '뚱뚱한(Fat)' AABB를 저장합니다.
+ *   오브젝트가 조금 움직여도 Fat AABB 안에 있으면 트리를 건드리지 않습니다. (MoveProxy)
+ * - 삽입은 표면적(SAH) 비용이 가장 작은 형제를 찾아 내려가고,
+ *   삽입/삭제 후 조상 노드를 리핏(Refit)하면서 회전(Rotation)으로 높이 균형을 맞춥니다.
+ * - 프러스텀 / AABB / 스피어 / 레이 질의를 제공합니다.
+ *   (컬링, 에디터 피킹, 게임플레이 근접 질의가 모두 이 트리를 공유합니다.)
+ *
+ * 콜백 형식
+ * - Query*: bool(int32_t proxyId) - false를 반환하면 순회를 중단합니다.
+ * - RayCast: float(int32_t proxyId, float maxDistance) - 새 최대 거리를 반환합니다.
+ *   (그대로 반환하면 계속, 더 작은 값이면 레이를 잘라내고, 0이면 중단)
+ * - RayCastPacket: void(int32_t proxyId, uint32_t laneMask) - laneMask의 레이들이 Fat AABB와 겹칩니다.
+ *   교차했다면 콜백이 packet.MaxDistance[lane]을 줄여 이후 순회를 잘라냅니다.
+ */
+class DynamicBVH
+{
+public:
+	static constexpr int32_t NULL_NODE = -1;
+
+	// margin: Fat AABB 여유 (각 축 양쪽), displacementMultiplier: 이동 방향으로 미리 늘려 둘 비율
+	explicit DynamicBVH(float margin = 0.1f, float displacementMultiplier = 2.0f);
+
+	// 프록시 생성/삭제. userData는 트리가 해석하지 않습니다. (예: GameObject*)
+	int32_t CreateProxy(const Aabb& box, void* userData);
+	void DestroyProxy(int32_t proxyId);
+
+	// 새 AABB가 기존 Fat AABB 안이면 아무것도 하지 않고 false를 반환합니다.
+	// 벗어났다면 리프를 떼어 다시 삽입하고 true를 반환합니다.
+	bool MoveProxy(int32_t proxyId, const Aabb& box, const DirectX::XMFLOAT3& displacement);
+
+	void* GetUserData(int32_t proxyId) const { return m_nodes[proxyId].UserData; }
+	Aabb GetFatAabb(int32_t proxyId) const;
+
+	size_t GetProxyCount() const { return m_proxyCount; }
+	int32_t GetHeight() const { return (m_root == NULL_NODE) ? 0 : m_nodes[m_root].Height; }
+
+	// 디버그용: 트리의 구조(부모/자식 링크, 높이, 포함 관계)가 올바른지 검사합니다.
+	bool Validate() const;
+
+	template<typename Callback>
+	void QueryAabb(const Aabb& box, Callback&& callback) const;
+
+	template<typename Callback>
+	void QuerySphere(const BoundingSphere& sphere, Callback&& callback) const;
+
+	// planes: (a, b, c, d), 안쪽이 양수 (CameraViewData::FrustumPlanes와 같은 규약)
+	template<typename Callback>
+	void QueryFrustum(const DirectX::XMFLOAT4A* planes, size_t planeCount, Callback&& callback) const;
+
+	template<typename Callback>
+	void RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance, Callback&& callback) const;
+
+	// 레이 4개를 함께 순회합니다. 노드마다 SSE 슬랩 검사 한 번으로 4개 레이를 검사하고,
+	// 하나라도 겹치면 내려갑니다.
+	template<typename Callback>
+	void RayCastPacket(RayPacket4& packet, Callback&& callback) const;
+
+private:
+	struct Node
+	{
+		DirectX::XMFLOAT3 Min;
+		DirectX::XMFLOAT3 Max;
+		void* UserData = nullptr;
+
+		int32_t Parent = NULL_NODE; // 프리 리스트에 있을 때는 다음 빈 노드
+		int32_t Child1 = NULL_NODE;
+		int32_t Child2 = NULL_NODE;
+		int32_t Height = -1;        // 리프 = 0, 빈 노드 = -1
+
+		bool IsLeaf() const { return Child1 == NULL_NODE; }
+	};
+
+	// 재귀 대신 쓰는 순회 스택 (트리 높이만큼만 쌓이므로 보통 고정 배열로 충분합니다)
+	class TraversalStack
+	{
+	public:
+		void Push(int32_t node)
+		{
+			if (m_count < FIXED_CAPACITY) m_fixed[m_count] = node;
+			else m_overflow.push_back(node);
+			++m_count;
+		}
+
+		int32_t Pop()
+		{
+			--m_count;
+			if (m_count < FIXED_CAPACITY) return m_fixed[m_count];
+
+			int32_t node = m_overflow.back();
+			m_overflow.pop_back();
+			return node;
+		}
+
+		bool IsEmpty() const { return m_count == 0; }
+
+	private:
+		static constexpr size_t FIXED_CAPACITY = 128;
+		int32_t m_fixed[FIXED_CAPACITY];
+		std::vector<int32_t> m_overflow;
+		size_t m_count = 0;
+	};
+
+	int32_t AllocateNode();
+	void FreeNode(int32_t nodeId);
+
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+	int32_t Balance(int32_t nodeId);
+	void RefitAncestors(int32_t nodeId);
+
+	bool ValidateNode(int32_t nodeId) const;
+
+	static float SurfaceArea(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max);
+	static bool Contains(const Node& outer, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max);
+
+	std::vector<Node> m_nodes;
+	int32_t m_root = NULL_NODE;
+	int32_t m_freeList = NULL_NODE;
+	size_t m_proxyCount = 0;
+
+	float m_margin;
+	float m_displacementMultiplier;
+};
+
+template<typename Callback>
+void DynamicBVH::QueryAabb(const Aabb& box, Callback&& callback) const
+{
+	const DirectX::XMFLOAT3 qMin = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+	const DirectX::XMFLOAT3 qMax = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+
+	TraversalStack stack;
+	if (m_root != NULL_NODE) stack.Push(m_root);
+
+	while (!stack.IsEmpty())
+	{
+		const Node& node = m_nodes[stack.Pop()];
+
+		if (node.Max.x < qMin.x || node.Min.x > qMax.x ||
+			node.Max.y < qMin.y || node.Min.y > qMax.y ||
+			node.Max.z < qMin.z || node.Min.z > qMax.z)
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			if (!callback(static_cast<int32_t>(&node - m_nodes.data()))) return;
+		}
+		else
+		{
+			stack.Push(node.Child1);
+			stack.Push(node.Child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicBVH::QuerySphere(const BoundingSphere& sphere, Callback&& callback) const
+{
+	const float radiusSq = sphere.Radius * sphere.Radius;
+
+	TraversalStack stack;
+	if (m_root != NULL_NODE) stack.Push(m_root);
+
+	while (!stack.IsEmpty())
+	{
+		const Node& node = m_nodes[stack.Pop()];
+
+		// 스피어 중심에서 AABB까지의 최단 거리 (제곱)
+		float dx = (std::max)((std::max)(node.Min.x - sphere.Center.x, 0.0f), sphere.Center.x - node.Max.x);
+		float dy = (std::max)((std::max)(node.Min.y - sphere.Center.y, 0.0f), sphere.Center.y - node.Max.y);
+		float dz = (std::max)((std::max)(node.Min.z - sphere.Center.z, 0.0f), sphere.Center.z - node.Max.z);
+		if (dx * dx + dy * dy + dz * dz > radiusSq) continue;
+
+		if (node.IsLeaf())
+		{
+			if (!callback(static_cast<int32_t>(&node - m_nodes.data()))) return;
+		}
+		else
+		{
+			stack.Push(node.Child1);
+			stack.Push(node.Child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicBVH::QueryFrustum(const DirectX::XMFLOAT4A* planes, size_t planeCount, Callback&& callback) const
+{
+	TraversalStack stack;
+	if (m_root != NULL_NODE) stack.Push(m_root);
+
+	while (!stack.IsEmpty())
+	{
+		const Node& node = m_nodes[stack.Pop()];
+
+		// 평면 법선 방향으로 가장 먼 꼭짓점(p-vertex)이 바깥이면 AABB 전체가 바깥입니다.
+		bool outside = false;
+		for (size_t p = 0; p < planeCount; ++p)
+		{
+			const DirectX::XMFLOAT4A& plane = planes[p];
+			float px = (plane.x >= 0.0f) ? node.Max.x : node.Min.x;
+			float py = (plane.y >= 0.0f) ? node.Max.y : node.Min.y;
+			float pz = (plane.z >= 0.0f) ? node.Max.z : node.Min.z;
+			if (plane.x * px + plane.y * py + plane.z * pz + plane.w < 0.0f)
+			{
+				outside = true;
+				break;
+			}
+		}
+		if (outside) continue;
+
+		if (node.IsLeaf())
+		{
+			if (!callback(static_cast<int32_t>(&node - m_nodes.data()))) return;
+		}
+		else
+		{
+			stack.Push(node.Child1);
+			stack.Push(node.Child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicBVH::RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance, Callback&& callback) const
+{
+	// 0으로 나누면 +-inf가 되어 슬랩 검사가 그대로 동작합니다.
+	const float invX = 1.0f / direction.x;
+	const float invY = 1.0f / direction.y;
+	const float invZ = 1.0f / direction.z;
+
+	TraversalStack stack;
+	if (m_root != NULL_NODE) stack.Push(m_root);
+
+	while (!stack.IsEmpty() && maxDistance > 0.0f)
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+
+		// 슬랩(Slab) 검사
+		float t1 = (node.Min.x - origin.x) * invX, t2 = (node.Max.x - origin.x) * invX;
+		float tMin = (std::min)(t1, t2), tMax = (std::max)(t1, t2);
+
+		t1 = (node.Min.y - origin.y) * invY; t2 = (node.Max.y - origin.y) * invY;
+		tMin = (std::max)(tMin, (std::min)(t1, t2)); tMax = (std::min)(tMax, (std::max)(t1, t2));
+
+		t1 = (node.Min.z - origin.z) * invZ; t2 = (node.Max.z - origin.z) * invZ;
+		tMin = (std::max)(tMin, (std::min)(t1, t2)); tMax = (std::min)(tMax, (std::max)(t1, t2));
+
+		// NaN(원점이 슬랩 경계 위이고 방향 성분이 0)은 비교가 false이므로 통과로 취급됩니다.
+		if (tMax < (std::max)(tMin, 0.0f) || tMin > maxDistance) continue;
+
+		if (node.IsLeaf())
+		{
+			maxDistance = (std::min)(maxDistance, static_cast<float>(callback(nodeId, maxDistance)));
+		}
+		else
+		{
+			stack.Push(node.Child1);
+			stack.Push(node.Child2);
+		}
+	}
+}
+
+template<typename Callback>
+void DynamicBVH::RayCastPacket(RayPacket4& packet, Callback&& callback) const
+{
+	const __m128 originX = _mm_load_ps(packet.OriginX);
+	const __m128 originY = _mm_load_ps(packet.OriginY);
+	const __m128 originZ = _mm_load_ps(packet.OriginZ);
+	const __m128 invX = _mm_load_ps(packet.InvDirectionX);
+	const __m128 invY = _mm_load_ps(packet.InvDirectionY);
+	const __m128 invZ = _mm_load_ps(packet.InvDirectionZ);
+	const __m128 zero = _mm_setzero_ps();
+
+	TraversalStack stack;
+	if (m_root != NULL_NODE && packet.ActiveMask != 0) stack.Push(m_root);
+
+	while (!stack.IsEmpty())
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+
+		// 슬랩(Slab) 검사를 4개 레인에 동시에 (역방향은 RayPacket4::Load에서 유한값으로 만들어 NaN이 없음)
+		__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Min.x), originX), invX);
+		__m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Max.x), originX), invX);
+		__m128 tMin = _mm_min_ps(t1, t2);
+		__m128 tMax = _mm_max_ps(t1, t2);
+
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Min.y), originY), invY);
+		t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Max.y), originY), invY);
+		tMin = _mm_max_ps(tMin, _mm_min_ps(t1, t2));
+		tMax = _mm_min_ps(tMax, _mm_max_ps(t1, t2));
+
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Min.z), originZ), invZ);
+		t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.Max.z), originZ), invZ);
+		tMin = _mm_max_ps(tMin, _mm_min_ps(t1, t2));
+		tMax = _mm_min_ps(tMax, _mm_max_ps(t1, t2));
+
+		// 콜백이 MaxDistance를 줄였을 수 있으므로 노드마다 다시 읽습니다.
+		const __m128 maxDistance = _mm_load_ps(packet.MaxDistance);
+		const __m128 hit = _mm_and_ps(
+			_mm_cmpge_ps(tMax, _mm_max_ps(tMin, zero)),
+			_mm_cmple_ps(tMin, maxDistance));
+
+		const uint32_t laneMask = static_cast<uint32_t>(_mm_movemask_ps(hit)) & packet.ActiveMask;
+		if (laneMask == 0) continue;
+
+		if (node.IsLeaf())
+		{
+			callback(nodeId, laneMask);
+		}
+		else
+		{
+			stack.Push(node.Child1);
+			stack.Push(node.Child2);
+		}
+	}
+}
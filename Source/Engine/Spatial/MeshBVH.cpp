@@ -0,0 +1,319 @@
+#include "MeshBVH.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr uint32_t MAX_DEPTH = 64; // 순회 스택 크기와 같음. 더 깊어지면 리프로 만듭니다.
+
+	inline const XMFLOAT3& PositionAt(const XMFLOAT3* positions, size_t stride, size_t index)
+	{
+		return *reinterpret_cast<const XMFLOAT3*>(reinterpret_cast<const unsigned char*>(positions) + index * stride);
+	}
+
+	struct Box
+	{
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		void Grow(const float* point)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				Min[axis] = (std::min)(Min[axis], point[axis]);
+				Max[axis] = (std::max)(Max[axis], point[axis]);
+			}
+		}
+
+		void Grow(const Box& other)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				Min[axis] = (std::min)(Min[axis], other.Min[axis]);
+				Max[axis] = (std::max)(Max[axis], other.Max[axis]);
+			}
+		}
+
+		float HalfArea() const
+		{
+			const float dx = Max[0] - Min[0], dy = Max[1] - Min[1], dz = Max[2] - Min[2];
+			return (dx < 0.0f) ? 0.0f : dx * dy + dy * dz + dz * dx;
+		}
+	};
+
+	struct BuildItem
+	{
+		uint32_t Node;
+		uint32_t First;
+		uint32_t Count;
+		uint32_t Depth;
+	};
+
+	// 슬랩 검사. 교차하면 진입 거리, 아니면 FLT_MAX
+	inline float IntersectNode(const XMFLOAT3& min, const XMFLOAT3& max,
+		const XMFLOAT3& origin, const XMFLOAT3& invDirection, float maxDistance)
+	{
+		float t1 = (min.x - origin.x) * invDirection.x, t2 = (max.x - origin.x) * invDirection.x;
+		float tMin = (std::min)(t1, t2), tMax = (std::max)(t1, t2);
+
+		t1 = (min.y - origin.y) * invDirection.y; t2 = (max.y - origin.y) * invDirection.y;
+		tMin = (std::max)(tMin, (std::min)(t1, t2)); tMax = (std::min)(tMax, (std::max)(t1, t2));
+
+		t1 = (min.z - origin.z) * invDirection.z; t2 = (max.z - origin.z) * invDirection.z;
+		tMin = (std::max)(tMin, (std::min)(t1, t2)); tMax = (std::min)(tMax, (std::max)(t1, t2));
+
+		if (tMax < (std::max)(tMin, 0.0f) || tMin > maxDistance) return FLT_MAX;
+		return tMin;
+	}
+}
+
+void MeshBVH::Build(const XMFLOAT3* positions, size_t stride, size_t vertexCount,
+	const uint32_t* indices, size_t indexCount)
+{
+	m_nodes.clear();
+	m_triangles.clear();
+	m_triangleIds.clear();
+
+	// 범위를 벗어난 인덱스를 가진 삼각형은 건너뜁니다.
+	const uint32_t sourceTriangleCount = static_cast<uint32_t>(indexCount / 3);
+	std::vector<Box> triangleBoxes;
+	std::vector<XMFLOAT3> centroids;
+	triangleBoxes.reserve(sourceTriangleCount);
+	centroids.reserve(sourceTriangleCount);
+	m_triangleIds.reserve(sourceTriangleCount);
+
+	for (uint32_t t = 0; t < sourceTriangleCount; ++t)
+	{
+		const uint32_t i0 = indices[3 * t], i1 = indices[3 * t + 1], i2 = indices[3 * t + 2];
+		if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) continue;
+
+		Box box;
+		box.Grow(&PositionAt(positions, stride, i0).x);
+		box.Grow(&PositionAt(positions, stride, i1).x);
+		box.Grow(&PositionAt(positions, stride, i2).x);
+
+		triangleBoxes.push_back(box);
+		centroids.push_back({ (box.Min[0] + box.Max[0]) * 0.5f, (box.Min[1] + box.Max[1]) * 0.5f, (box.Min[2] + box.Max[2]) * 0.5f });
+		m_triangleIds.push_back(t);
+	}
+
+	const uint32_t triangleCount = static_cast<uint32_t>(m_triangleIds.size());
+	if (triangleCount == 0) return;
+
+	// 아래 분할 중에는 m_triangleIds 대신 0..N-1 '로컬 순번'을 섞고, 끝난 뒤 원래 인덱스로 바꿉니다.
+	std::vector<uint32_t> order(triangleCount);
+	for (uint32_t i = 0; i < triangleCount; ++i) order[i] = i;
+
+	m_nodes.reserve(2 * static_cast<size_t>(triangleCount));
+	m_nodes.push_back({});
+
+	std::vector<BuildItem> work;
+	work.push_back({ 0, 0, triangleCount, 0 });
+
+	while (!work.empty())
+	{
+		const BuildItem item = work.back();
+		work.pop_back();
+
+		Box bounds, centroidBounds;
+		for (uint32_t i = item.First; i < item.First + item.Count; ++i)
+		{
+			bounds.Grow(triangleBoxes[order[i]]);
+			centroidBounds.Grow(&centroids[order[i]].x);
+		}
+
+		Node& node = m_nodes[item.Node];
+		node.Min = { bounds.Min[0], bounds.Min[1], bounds.Min[2] };
+		node.Max = { bounds.Max[0], bounds.Max[1], bounds.Max[2] };
+		node.FirstOrChild = item.First;
+		node.TriangleCount = item.Count;
+
+		if (item.Count <= MAX_LEAF_TRIANGLES || item.Depth + 1 >= MAX_DEPTH) continue;
+
+		// 축마다 BIN_COUNT개 구간에 중심을 모으고, 구간 경계 중 SAH 비용이 가장 작은 곳을 찾습니다.
+		float bestCost = FLT_MAX;
+		int bestAxis = -1;
+		uint32_t bestSplit = 0;
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float extent = centroidBounds.Max[axis] - centroidBounds.Min[axis];
+			if (extent <= 0.0f) continue;
+
+			Box binBoxes[BIN_COUNT];
+			uint32_t binCounts[BIN_COUNT] = {};
+			const float scale = BIN_COUNT / extent;
+
+			for (uint32_t i = item.First; i < item.First + item.Count; ++i)
+			{
+				const float c = (&centroids[order[i]].x)[axis];
+				const uint32_t bin = (std::min)(static_cast<uint32_t>((c - centroidBounds.Min[axis]) * scale), BIN_COUNT - 1);
+				binBoxes[bin].Grow(triangleBoxes[order[i]]);
+				++binCounts[bin];
+			}
+
+			// 왼쪽에서 누적한 비용을 저장해 두고, 오른쪽에서 누적하며 합칩니다.
+			float leftArea[BIN_COUNT - 1];
+			uint32_t leftCount[BIN_COUNT - 1];
+			Box leftBox;
+			uint32_t count = 0;
+			for (uint32_t b = 0; b < BIN_COUNT - 1; ++b)
+			{
+				leftBox.Grow(binBoxes[b]);
+				count += binCounts[b];
+				leftArea[b] = leftBox.HalfArea();
+				leftCount[b] = count;
+			}
+
+			Box rightBox;
+			count = 0;
+			for (uint32_t b = BIN_COUNT - 1; b > 0; --b)
+			{
+				rightBox.Grow(binBoxes[b]);
+				count += binCounts[b];
+
+				const float cost = leftArea[b - 1] * leftCount[b - 1] + rightBox.HalfArea() * count;
+				if (leftCount[b - 1] > 0 && count > 0 && cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplit = b;
+				}
+			}
+		}
+
+		// 나누는 비용이 리프로 두는 비용보다 크면 리프 (중심이 모두 한 점이어도 리프)
+		if (bestAxis < 0 || bestCost >= bounds.HalfArea() * item.Count) continue;
+
+		const float scale = BIN_COUNT / (centroidBounds.Max[bestAxis] - centroidBounds.Min[bestAxis]);
+		uint32_t* begin = order.data() + item.First;
+		uint32_t* middle = std::partition(begin, begin + item.Count, [&](uint32_t id)
+		{
+			const float c = (&centroids[id].x)[bestAxis];
+			return (std::min)(static_cast<uint32_t>((c - centroidBounds.Min[bestAxis]) * scale), BIN_COUNT - 1) < bestSplit;
+		});
+
+		const uint32_t leftCountFinal = static_cast<uint32_t>(middle - begin);
+		if (leftCountFinal == 0 || leftCountFinal == item.Count) continue;
+
+		const uint32_t leftChild = static_cast<uint32_t>(m_nodes.size());
+		m_nodes.push_back({});
+		m_nodes.push_back({});
+
+		// push_back 후에는 참조가 무효일 수 있으므로 다시 찾습니다.
+		m_nodes[item.Node].FirstOrChild = leftChild;
+		m_nodes[item.Node].TriangleCount = 0;
+
+		work.push_back({ leftChild + 1, item.First + leftCountFinal, item.Count - leftCountFinal, item.Depth + 1 });
+		work.push_back({ leftChild, item.First, leftCountFinal, item.Depth + 1 });
+	}
+
+	// 리프 순서대로 삼각형을 복사합니다.
+	std::vector<uint32_t> sourceIds(m_triangleIds);
+	m_triangles.resize(triangleCount);
+	for (uint32_t i = 0; i < triangleCount; ++i)
+	{
+		const uint32_t t = sourceIds[order[i]];
+		const XMFLOAT3& v0 = PositionAt(positions, stride, indices[3 * t]);
+		const XMFLOAT3& v1 = PositionAt(positions, stride, indices[3 * t + 1]);
+		const XMFLOAT3& v2 = PositionAt(positions, stride, indices[3 * t + 2]);
+
+		m_triangles[i].V0 = v0;
+		m_triangles[i].Edge1 = { v1.x - v0.x, v1.y - v0.y, v1.z - v0.z };
+		m_triangles[i].Edge2 = { v2.x - v0.x, v2.y - v0.y, v2.z - v0.z };
+		m_triangleIds[i] = t;
+	}
+}
+
+bool MeshBVH::RayCast(const XMFLOAT3& origin, const XMFLOAT3& direction, float maxDistance, Hit& outHit) const
+{
+	if (m_nodes.empty()) return false;
+
+	// 0으로 나누면 +-inf가 되어 슬랩 검사가 그대로 동작합니다.
+	const XMFLOAT3 invDirection = { 1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z };
+
+	float closest = maxDistance;
+	bool found = false;
+
+	uint32_t stack[MAX_DEPTH];
+	uint32_t stackSize = 0;
+
+	if (IntersectNode(m_nodes[0].Min, m_nodes[0].Max, origin, invDirection, closest) == FLT_MAX) return false;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = node.FirstOrChild; i < node.FirstOrChild + node.TriangleCount; ++i)
+			{
+				// Moller-Trumbore (양면)
+				const Triangle& tri = m_triangles[i];
+				const XMFLOAT3& e1 = tri.Edge1;
+				const XMFLOAT3& e2 = tri.Edge2;
+
+				const float px = direction.y * e2.z - direction.z * e2.y;
+				const float py = direction.z * e2.x - direction.x * e2.z;
+				const float pz = direction.x * e2.y - direction.y * e2.x;
+				const float det = e1.x * px + e1.y * py + e1.z * pz;
+				if (std::fabs(det) < 1e-20f) continue; // 레이와 평행
+
+				const float invDet = 1.0f / det;
+				const float sx = origin.x - tri.V0.x, sy = origin.y - tri.V0.y, sz = origin.z - tri.V0.z;
+				const float u = (sx * px + sy * py + sz * pz) * invDet;
+				if (u < 0.0f || u > 1.0f) continue;
+
+				const float qx = sy * e1.z - sz * e1.y;
+				const float qy = sz * e1.x - sx * e1.z;
+				const float qz = sx * e1.y - sy * e1.x;
+				const float v = (direction.x * qx + direction.y * qy + direction.z * qz) * invDet;
+				if (v < 0.0f || u + v > 1.0f) continue;
+
+				const float t = (e2.x * qx + e2.y * qy + e2.z * qz) * invDet;
+				if (t < 0.0f || t > closest) continue;
+
+				closest = t;
+				found = true;
+				outHit.Distance = t;
+				outHit.TriangleIndex = m_triangleIds[i];
+				outHit.U = u;
+				outHit.V = v;
+			}
+			continue;
+		}
+
+		// 가까운 자식을 나중에 넣어 먼저 꺼냅니다.
+		const uint32_t left = node.FirstOrChild;
+		const uint32_t right = left + 1;
+		const float tLeft = IntersectNode(m_nodes[left].Min, m_nodes[left].Max, origin, invDirection, closest);
+		const float tRight = IntersectNode(m_nodes[right].Min, m_nodes[right].Max, origin, invDirection, closest);
+
+		const bool leftFirst = tLeft <= tRight;
+		const uint32_t nearChild = leftFirst ? left : right;
+		const uint32_t farChild = leftFirst ? right : left;
+		const float tNear = leftFirst ? tLeft : tRight;
+		const float tFar = leftFirst ? tRight : tLeft;
+
+		if (tFar != FLT_MAX) stack[stackSize++] = farChild;
+		if (tNear != FLT_MAX) stack[stackSize++] = nearChild;
+	}
+
+	return found;
+}
+
+Aabb MeshBVH::GetBounds() const
+{
+	Aabb box;
+	if (m_nodes.empty()) return box;
+
+	const Node& root = m_nodes[0];
+	box.Center = { (root.Min.x + root.Max.x) * 0.5f, (root.Min.y + root.Max.y) * 0.5f, (root.Min.z + root.Max.z) * 0.5f };
+	box.Extents = { (root.Max.x - root.Min.x) * 0.5f, (root.Max.y - root.Min.y) * 0.5f, (root.Max.z - root.Min.z) * 0.5f };
+	return box;
+}
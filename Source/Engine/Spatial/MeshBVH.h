@@ -0,0 +1,68 @@
+// MeshBVH.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+
+#include "Math/Bounds.h"
+
+/*
+ * [MeshBVH]
+ * 메쉬 하나(로컬 공간)의 삼각형들에 대한 정적 BVH입니다.
+ * - 임포트 후 한 번 빌드하고, 같은 메쉬를 쓰는 오브젝트들이 공유합니다. (BoundsComponent::SetMeshBVH)
+ * - 빌드: 삼각형 중심을 축마다 BIN_COUNT개 구간으로 나눠 표면적(SAH) 비용이 가장 작은 분할을 고릅니다.
+ *   노드는 배열 하나에 깊이 우선으로 펼쳐 두고, 자식 두 개는 항상 붙어 있습니다.
+ * - 레이 질의: 가까운 자식부터 내려가며, 가장 가까운 교차보다 먼 노드는 건너뜁니다.
+ *   삼각형 검사는 양면(Two-sided) Moller-Trumbore입니다.
+ *
+ * 삼각형 인덱스는 빌드에 넘긴 인덱스 배열 기준입니다. (indices[3 * i .. 3 * i + 2])
+ * 빌드 후에는 읽기 전용이므로 여러 스레드에서 동시에 질의해도 됩니다.
+ */
+class MeshBVH
+{
+public:
+	static constexpr uint32_t BIN_COUNT = 8;
+	static constexpr uint32_t MAX_LEAF_TRIANGLES = 4;
+
+	struct Hit
+	{
+		float Distance = 0.0f;      // 레이 방향 길이 단위
+		uint32_t TriangleIndex = 0; // 빌드에 넘긴 인덱스 배열 기준
+		float U = 0.0f, V = 0.0f;   // 무게중심 좌표 (정점 1, 2의 가중치)
+	};
+
+	// positions: 첫 번째 위치 주소, stride: 정점 하나의 바이트 크기, indices: 삼각형 리스트
+	void Build(const DirectX::XMFLOAT3* positions, size_t stride, size_t vertexCount,
+		const uint32_t* indices, size_t indexCount);
+
+	// [0, maxDistance] 안에서 가장 가까운 삼각형. 없으면 false
+	bool RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance, Hit& outHit) const;
+
+	bool IsEmpty() const { return m_nodes.empty(); }
+	size_t GetTriangleCount() const { return m_triangleIds.size(); }
+	size_t GetNodeCount() const { return m_nodes.size(); }
+	Aabb GetBounds() const;
+
+private:
+	struct Node
+	{
+		DirectX::XMFLOAT3 Min;
+		uint32_t FirstOrChild; // 리프: 첫 삼각형 (m_triangleIds 기준), 내부: 왼쪽 자식 (오른쪽은 +1)
+		DirectX::XMFLOAT3 Max;
+		uint32_t TriangleCount; // 0이면 내부 노드
+
+		bool IsLeaf() const { return TriangleCount != 0; }
+	};
+
+	// 빌드 후 삼각형 정점은 리프 순서대로 복사해 두어 질의 시 인덱스를 따라가지 않습니다.
+	struct Triangle
+	{
+		DirectX::XMFLOAT3 V0, Edge1, Edge2; // V0, V1 - V0, V2 - V0
+	};
+
+	std::vector<Node> m_nodes;
+	std::vector<Triangle> m_triangles;   // 리프 순서
+	std::vector<uint32_t> m_triangleIds; // 리프 순서 -> 원래 삼각형 인덱스
+};
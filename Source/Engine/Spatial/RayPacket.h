@@ -0,0 +1,72 @@
+// RayPacket.h
+#pragma once
+
+#include <cfloat>
+#include <cstdint>
+#include <DirectXMath.h>
+
+// 배치 레이 질의 입력. 거리는 Direction 길이 단위입니다. (정규화 불필요)
+struct Ray
+{
+	DirectX::XMFLOAT3 Origin = { 0.0f, 0.0f, 0.0f };
+	DirectX::XMFLOAT3 Direction = { 0.0f, 0.0f, 1.0f };
+	float MaxDistance = FLT_MAX;
+};
+
+/*
+ * [RayPacket4]
+ * 레이 4개를 SoA로 묶은 패킷입니다. 트리 노드 하나를 SSE 한 번으로 4개 레이에 대해 검사합니다.
+ * - 4개보다 적게 담으면 빈 레인은 ActiveMask에서 빠지고 MaxDistance가 음수라 절대 맞지 않습니다.
+ * - 방향 부호(옥탄트)가 모두 같은 레이끼리(IsCoherent) 묶였을 때 같은 노드를 함께 방문하므로 가장 효율적입니다.
+ * - MaxDistance는 순회 중에 콜백이 줄여 나갑니다. (가장 가까운 교차 이후의 노드는 건너뜀)
+ */
+struct alignas(16) RayPacket4
+{
+	float OriginX[4], OriginY[4], OriginZ[4];
+	float InvDirectionX[4], InvDirectionY[4], InvDirectionZ[4];
+	float MaxDistance[4];
+	uint32_t ActiveMask = 0;
+
+	// count <= 4
+	void Load(const Ray* rays, uint32_t count)
+	{
+		ActiveMask = 0;
+		for (uint32_t lane = 0; lane < 4; ++lane)
+		{
+			const Ray& ray = rays[(lane < count) ? lane : 0];
+			OriginX[lane] = ray.Origin.x;
+			OriginY[lane] = ray.Origin.y;
+			OriginZ[lane] = ray.Origin.z;
+			InvDirectionX[lane] = SafeInverse(ray.Direction.x);
+			InvDirectionY[lane] = SafeInverse(ray.Direction.y);
+			InvDirectionZ[lane] = SafeInverse(ray.Direction.z);
+			MaxDistance[lane] = (lane < count) ? ray.MaxDistance : -1.0f;
+			if (lane < count) ActiveMask |= 1u << lane;
+		}
+	}
+
+	// 모든 레이의 방향 부호가 축마다 같은지
+	static bool IsCoherent(const Ray* rays, uint32_t count)
+	{
+		const uint32_t octant = Octant(rays[0].Direction);
+		for (uint32_t i = 1; i < count; ++i)
+		{
+			if (Octant(rays[i].Direction) != octant) return false;
+		}
+		return true;
+	}
+
+private:
+	// 0 * inf = NaN이 SSE min/max에서 한쪽 값으로 바뀌는 것을 막기 위해 무한대 대신 큰 유한값을 씁니다.
+	static float SafeInverse(float value)
+	{
+		constexpr float LARGE = 1e30f;
+		if (value > 1.0f / LARGE || value < -1.0f / LARGE) return 1.0f / value;
+		return (value < 0.0f) ? -LARGE : LARGE;
+	}
+
+	static uint32_t Octant(const DirectX::XMFLOAT3& direction)
+	{
+		return (direction.x < 0.0f ? 1u : 0u) | (direction.y < 0.0f ? 2u : 0u) | (direction.z < 0.0f ? 4u : 0u);
+	}
+};
@@ -0,0 +1,223 @@
+#include "SpatialHashGrid.h"
+
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr uint32_t MIN_BUCKET_COUNT = 64;
+	constexpr size_t MIN_GRAIN_SIZE = 1024; // 청크가 이보다 작으면 스레드 분배 비용이 더 큽니다.
+
+	uint32_t NextPowerOfTwo(uint32_t value)
+	{
+		uint32_t result = 1;
+		while (result < value) result <<= 1;
+		return result;
+	}
+}
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+	: m_cellSize(cellSize), m_invCellSize(1.0f / cellSize)
+{
+}
+
+int32_t SpatialHashGrid::ToCell(float value) const
+{
+	return static_cast<int32_t>(std::floor(value * m_invCellSize));
+}
+
+uint32_t SpatialHashGrid::HashCell(int32_t x, int32_t y, int32_t z) const
+{
+	// Teschner et al. (2003)의 큰 소수 XOR 해시
+	const uint32_t h = (static_cast<uint32_t>(x) * 73856093u) ^
+		(static_cast<uint32_t>(y) * 19349663u) ^
+		(static_cast<uint32_t>(z) * 83492791u);
+	return h & m_bucketMask;
+}
+
+void SpatialHashGrid::Build(const XMFLOAT3* positions, size_t count, JobSystem* jobs)
+{
+	// 버킷 수는 엔티티 수 이상의 2의 거듭제곱 (적재율 1 이하)
+	const uint32_t bucketCount = (std::max)(MIN_BUCKET_COUNT, NextPowerOfTwo(static_cast<uint32_t>(count)));
+	m_bucketMask = bucketCount - 1;
+
+	m_bucketOfEntity.resize(count);
+	m_sortedIndices.resize(count);
+	m_sortedPositions.resize(count);
+	m_cellStart.assign(static_cast<size_t>(bucketCount) + 1, 0);
+
+	const size_t threadCount = jobs ? jobs->GetThreadCount() : 1;
+	const size_t grainSize = (std::max)(MIN_GRAIN_SIZE, (count + threadCount - 1) / threadCount);
+	const size_t chunkCount = (std::max)(size_t(1), JobSystem::GetChunkCount(count, grainSize));
+
+	m_chunkHistograms.assign(chunkCount * bucketCount, 0);
+
+	auto runChunks = [&](const std::function<void(size_t, size_t)>& func)
+	{
+		if (jobs) jobs->ParallelFor(count, grainSize, func);
+		else if (count > 0) func(0, count);
+	};
+
+	// 1. 버킷 계산 + 청크별 히스토그램
+	runChunks([&](size_t begin, size_t end)
+	{
+		uint32_t* histogram = &m_chunkHistograms[(begin / grainSize) * bucketCount];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const XMFLOAT3& p = positions[i];
+			const uint32_t bucket = HashCell(ToCell(p.x), ToCell(p.y), ToCell(p.z));
+			m_bucketOfEntity[i] = bucket;
+			++histogram[bucket];
+		}
+	});
+
+	// 2. 누적합: 버킷 순서 -> 청크 순서로 시작 위치를 매깁니다. (청크 히스토그램은 각 청크의 쓰기 위치로 바뀜)
+	uint32_t running = 0;
+	for (uint32_t bucket = 0; bucket < bucketCount; ++bucket)
+	{
+		m_cellStart[bucket] = running;
+		for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			uint32_t& slot = m_chunkHistograms[chunk * bucketCount + bucket];
+			const uint32_t chunkCountInBucket = slot;
+			slot = running;
+			running += chunkCountInBucket;
+		}
+	}
+	m_cellStart[bucketCount] = running;
+
+	// 3. 분배: 청크마다 자기 구간에만 쓰므로 락이 필요 없고, 버킷 안에서는 원래 순서가 유지됩니다.
+	runChunks([&](size_t begin, size_t end)
+	{
+		uint32_t* writeOffsets = &m_chunkHistograms[(begin / grainSize) * bucketCount];
+		for (size_t i = begin; i < end; ++i)
+		{
+			const uint32_t dst = writeOffsets[m_bucketOfEntity[i]]++;
+			m_sortedIndices[dst] = static_cast<uint32_t>(i);
+			m_sortedPositions[dst] = positions[i];
+		}
+	});
+}
+
+template<typename Func>
+void SpatialHashGrid::ForEachBucketInRadius(const XMFLOAT3& center, float radius, std::vector<uint32_t>& buckets, Func&& func) const
+{
+	if (m_sortedIndices.empty()) return;
+
+	// 반지름이 너무 커서 셀 좌표가 정수 범위를 넘을 수 있으면 바로 전체를 훑습니다. (maxRadius = FLT_MAX 등)
+	if (!(radius * m_invCellSize < static_cast<float>(m_bucketMask + 1)))
+	{
+		func(size_t(0), m_sortedIndices.size());
+		return;
+	}
+
+	const int32_t minX = ToCell(center.x - radius), maxX = ToCell(center.x + radius);
+	const int32_t minY = ToCell(center.y - radius), maxY = ToCell(center.y + radius);
+	const int32_t minZ = ToCell(center.z - radius), maxZ = ToCell(center.z + radius);
+
+	const uint64_t cellCount = uint64_t(maxX - minX + 1) * uint64_t(maxY - minY + 1) * uint64_t(maxZ - minZ + 1);
+
+	// 버킷 수보다 많은 셀을 덮으면 모든 버킷을 한 번에 훑는 편이 낫습니다.
+	if (cellCount > m_bucketMask + 1ull)
+	{
+		func(size_t(0), m_sortedIndices.size());
+		return;
+	}
+
+	// 서로 다른 셀이 같은 버킷에 들어갈 수 있으므로, 중복을 없앤 뒤 방문합니다.
+	buckets.clear();
+	for (int32_t z = minZ; z <= maxZ; ++z)
+		for (int32_t y = minY; y <= maxY; ++y)
+			for (int32_t x = minX; x <= maxX; ++x)
+				buckets.push_back(HashCell(x, y, z));
+
+	std::sort(buckets.begin(), buckets.end());
+	buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+
+	for (uint32_t bucket : buckets)
+	{
+		const uint32_t begin = m_cellStart[bucket];
+		const uint32_t end = m_cellStart[bucket + 1];
+		if (begin != end) func(size_t(begin), size_t(end));
+	}
+}
+
+std::span<const uint32_t> SpatialHashGrid::QueryRadius(const XMFLOAT3& center, float radius,
+	std::vector<uint32_t>& out, QueryScratch& scratch) const
+{
+	const size_t first = out.size();
+	const float radiusSq = radius * radius;
+
+	ForEachBucketInRadius(center, radius, scratch.Buckets, [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			const XMFLOAT3& p = m_sortedPositions[i];
+			const float dx = p.x - center.x, dy = p.y - center.y, dz = p.z - center.z;
+			if (dx * dx + dy * dy + dz * dz <= radiusSq)
+			{
+				out.push_back(m_sortedIndices[i]);
+			}
+		}
+	});
+
+	return std::span<const uint32_t>(out.data() + first, out.size() - first);
+}
+
+std::span<const uint32_t> SpatialHashGrid::QueryKNearest(const XMFLOAT3& center, size_t k, float maxRadius,
+	std::vector<uint32_t>& out, QueryScratch& scratch) const
+{
+	out.clear();
+	if (k == 0 || m_sortedIndices.empty()) return {};
+
+	// 반지름 r 안에서 k개 이상 찾았다면, r 밖의 엔티티는 그보다 멀기 때문에 답이 확정됩니다.
+	// 못 찾았으면 r을 두 배로 늘려 다시 찾습니다.
+	std::vector<std::pair<float, uint32_t>>& candidates = scratch.Candidates;
+	float radius = (std::min)(m_cellSize, maxRadius);
+
+	for (;;)
+	{
+		const float radiusSq = radius * radius;
+		candidates.clear();
+
+		ForEachBucketInRadius(center, radius, scratch.Buckets, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const XMFLOAT3& p = m_sortedPositions[i];
+				const float dx = p.x - center.x, dy = p.y - center.y, dz = p.z - center.z;
+				const float distSq = dx * dx + dy * dy + dz * dz;
+				if (distSq <= radiusSq)
+				{
+					candidates.emplace_back(distSq, m_sortedIndices[i]);
+				}
+			}
+		});
+
+		if (candidates.size() >= k || radius >= maxRadius) break;
+		radius = (std::min)(radius * 2.0f, maxRadius);
+	}
+
+	// (거리 제곱, 인덱스) 순으로 정렬하므로 거리가 같으면 인덱스가 작은 쪽이 먼저입니다.
+	const size_t resultCount = (std::min)(k, candidates.size());
+	std::partial_sort(candidates.begin(), candidates.begin() + resultCount, candidates.end());
+
+	for (size_t i = 0; i < resultCount; ++i)
+	{
+		out.push_back(candidates[i].second);
+	}
+	return out;
+}
+
+std::span<const uint32_t> SpatialHashGrid::GetCellSpan(const XMFLOAT3& position) const
+{
+	if (m_sortedIndices.empty()) return {};
+
+	const uint32_t bucket = HashCell(ToCell(position.x), ToCell(position.y), ToCell(position.z));
+	return std::span<const uint32_t>(m_sortedIndices.data() + m_cellStart[bucket], m_cellStart[bucket + 1] - m_cellStart[bucket]);
+}
@@ -0,0 +1,81 @@
+// SpatialHashGrid.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include <DirectXMath.h>
+
+class JobSystem;
+
+/*
+ * [SpatialHashGrid]
+ * 균일 격자 + 해시 테이블 기반의 근접 질의 구조입니다.
+ * 수만 개의 작은 엔티티(군집, AI 에이전트)가 매 프레임 움직이는 경우,
+ * 트리를 엔티티마다 갱신하는 것보다 매 프레임 통째로 다시 만드는 편이 빠릅니다.
+ *
+ * - 셀 좌표 (ix, iy, iz)를 해시해 버킷을 고르고, 카운팅 정렬로 버킷 순서대로 인덱스를 재배치합니다.
+ *   (1. 버킷 계산  2. 청크별 히스토그램  3. 누적합  4. 분배 - 1, 2, 4는 JobSystem으로 병렬 처리)
+ * - 같은 버킷의 엔티티는 배열에서 연속이므로 질의는 '조밀한 인덱스 구간(span)'을 순서대로 읽습니다.
+ * - 서로 다른 셀이 같은 버킷에 들어갈 수 있으므로 질의는 항상 실제 거리로 다시 확인합니다.
+ *
+ * 질의는 결과와 중간 버퍼를 호출자에게서 받으므로, 버퍼를 재사용하면 질의 중에 메모리를 할당하지 않습니다.
+ * Build 이후에는 여러 스레드가 동시에 질의해도 됩니다. (QueryScratch는 스레드마다 따로)
+ */
+class SpatialHashGrid
+{
+public:
+	// 질의 중간 버퍼. 스레드마다 하나씩 두고 계속 재사용하세요.
+	struct QueryScratch
+	{
+		std::vector<uint32_t> Buckets;                          // 반지름이 덮는 버킷 (중복 제거)
+		std::vector<std::pair<float, uint32_t>> Candidates;     // k-최근접 후보 (거리 제곱, 인덱스)
+	};
+
+	// cellSize: 보통 가장 흔한 질의 반지름 정도, 버킷 수는 Build 때 엔티티 수에 맞춰 정합니다.
+	explicit SpatialHashGrid(float cellSize = 1.0f);
+
+	// positions[i]의 인덱스 i를 격자에 넣습니다. jobs가 nullptr이면 호출 스레드에서 처리합니다.
+	void Build(const DirectX::XMFLOAT3* positions, size_t count, JobSystem* jobs = nullptr);
+
+	// center에서 radius 이내의 엔티티 인덱스를 out 뒤에 추가하고, 추가한 구간을 돌려줍니다. (순서는 버킷 순)
+	std::span<const uint32_t> QueryRadius(const DirectX::XMFLOAT3& center, float radius,
+		std::vector<uint32_t>& out, QueryScratch& scratch) const;
+
+	// 가장 가까운 k개를 가까운 순서로 out에 씁니다. (out은 비움) maxRadius 밖은 찾지 않습니다.
+	// 거리가 같으면 인덱스가 작은 쪽이 먼저입니다.
+	std::span<const uint32_t> QueryKNearest(const DirectX::XMFLOAT3& center, size_t k, float maxRadius,
+		std::vector<uint32_t>& out, QueryScratch& scratch) const;
+
+	// 셀 하나(버킷)에 들어 있는 엔티티 인덱스 구간. (다른 셀이 섞여 있을 수 있음)
+	std::span<const uint32_t> GetCellSpan(const DirectX::XMFLOAT3& position) const;
+
+	// 버킷 순서로 재배치된 인덱스 전체 (같은 버킷끼리 연속)
+	std::span<const uint32_t> GetSortedIndices() const { return m_sortedIndices; }
+
+	float GetCellSize() const { return m_cellSize; }
+	size_t GetCount() const { return m_sortedIndices.size(); }
+	uint32_t GetBucketCount() const { return m_bucketMask + 1; }
+
+private:
+	int32_t ToCell(float value) const;
+	uint32_t HashCell(int32_t x, int32_t y, int32_t z) const;
+
+	// 반지름 안에 걸치는 모든 셀의 버킷을 한 번씩만 방문하면서 func(begin, end)를 호출합니다.
+	template<typename Func>
+	void ForEachBucketInRadius(const DirectX::XMFLOAT3& center, float radius, std::vector<uint32_t>& buckets, Func&& func) const;
+
+	float m_cellSize;
+	float m_invCellSize;
+	uint32_t m_bucketMask = 0; // 버킷 수 - 1 (2의 거듭제곱)
+
+	std::vector<uint32_t> m_cellStart;      // 버킷 b의 구간 = [m_cellStart[b], m_cellStart[b + 1])
+	std::vector<uint32_t> m_sortedIndices;  // 버킷 순서로 정렬된 엔티티 인덱스
+	std::vector<DirectX::XMFLOAT3> m_sortedPositions; // m_sortedIndices와 같은 순서 (질의 시 연속 읽기)
+
+	// Build 중간 버퍼 (매 프레임 재사용)
+	std::vector<uint32_t> m_bucketOfEntity;
+	std::vector<uint32_t> m_chunkHistograms; // [청크][버킷]
+};
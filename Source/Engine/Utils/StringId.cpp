@@ -0,0 +1,56 @@
+#include "StringId.h"
+
+#include <cassert>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace
+{
+	// 전역 문자열 테이블 (해시 -> 원본 문자열)
+	// unordered_map은 노드 기반이므로 rehash가 일어나도 문자열의 참조는 유효합니다.
+	struct StringTable
+	{
+		std::shared_mutex mutex;
+		std::unordered_map<StringId::HashType, std::string> strings;
+	};
+
+	StringTable& GetStringTable()
+	{
+		static StringTable s_table;
+		return s_table;
+	}
+}
+
+StringId::StringId(std::string_view str) : m_hash(Hash(str))
+{
+	StringTable& table = GetStringTable();
+
+	// 대부분은 이미 등록된 이름이므로 읽기 락으로 먼저 확인합니다.
+	{
+		std::shared_lock<std::shared_mutex> lock(table.mutex);
+		auto it = table.strings.find(m_hash);
+		if (it != table.strings.end())
+		{
+			assert(it->second == str && "StringId hash collision!");
+			return;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(table.mutex);
+	table.strings.try_emplace(m_hash, str);
+}
+
+const std::string& StringId::GetString() const
+{
+	static const std::string s_empty;
+	static const std::string s_unknown = "<unknown>";
+
+	if (IsEmpty()) return s_empty;
+
+	StringTable& table = GetStringTable();
+	std::shared_lock<std::shared_mutex> lock(table.mutex);
+
+	auto it = table.strings.find(m_hash);
+	return (it != table.strings.end()) ? it->second : s_unknown;
+}
@@ -0,0 +1,67 @@
+// StringId.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <functional>
+
+/*
+ * [StringId]
+ * 문자열을 64비트 해시(FNV-1a)로 표현하는 '인턴(Intern)된 이름' 타입입니다.
+ * - 오브젝트마다 std::string을 들고 다니지 않고 8바이트 해시만 저장합니다.
+ * - 원본 문자열은 전역 문자열 테이블에 '한 번만' 저장됩니다. (GetString()으로 조회)
+ * - 비교와 해시맵 조회가 정수 비교 한 번이므로 이름 검색이 O(1)이 됩니다.
+ *
+ * 오브젝트 이름, 태그, 에셋 키에 사용합니다.
+ */
+class StringId
+{
+public:
+	using HashType = uint64_t;
+
+	static constexpr HashType FNV_OFFSET_BASIS = 14695981039346656037ull;
+	static constexpr HashType FNV_PRIME = 1099511628211ull;
+
+	StringId() = default;
+	StringId(const char* str) : StringId(std::string_view(str)) {}
+	StringId(const std::string& str) : StringId(std::string_view(str)) {}
+	StringId(std::string_view str);
+
+	// 컴파일 타임에도 계산 가능한 FNV-1a 64비트 해시
+	static constexpr HashType Hash(std::string_view str)
+	{
+		HashType hash = FNV_OFFSET_BASIS;
+		for (char c : str)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	HashType GetHash() const { return m_hash; }
+	bool IsEmpty() const { return m_hash == EMPTY_HASH; }
+
+	// 전역 문자열 테이블에서 원본 문자열을 찾습니다. (디버그/툴 표시용)
+	const std::string& GetString() const;
+
+	bool operator==(const StringId& other) const { return m_hash == other.m_hash; }
+	bool operator!=(const StringId& other) const { return m_hash != other.m_hash; }
+	bool operator<(const StringId& other) const { return m_hash < other.m_hash; }
+
+private:
+	static constexpr HashType EMPTY_HASH = FNV_OFFSET_BASIS; // Hash("")
+
+	HashType m_hash = EMPTY_HASH;
+};
+
+// std::unordered_map의 키로 사용하기 위한 특수화 (이미 해시이므로 그대로 반환)
+template<>
+struct std::hash<StringId>
+{
+	size_t operator()(const StringId& id) const noexcept
+	{
+		return static_cast<size_t>(id.GetHash());
+	}
+};
@@ -0,0 +1,342 @@
+// TlsfAllocator.cpp
+#include "Utils/TlsfAllocator.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+	uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	uint32_t Log2(uint64_t value)
+	{
+		return static_cast<uint32_t>(std::bit_width(value)) - 1;
+	}
+}
+
+TlsfAllocator::TlsfAllocator(uint64_t capacity, uint64_t granularity)
+	: m_capacity(capacity - capacity % granularity), m_granularity(granularity)
+{
+	for (auto& row : m_freeLists)
+	{
+		std::fill(std::begin(row), std::end(row), INVALID_HANDLE);
+	}
+
+	// 처음에는 전체가 빈 블록 하나
+	if (m_capacity > 0)
+	{
+		m_firstBlock = CreateBlock();
+		m_blocks[m_firstBlock].Offset = 0;
+		m_blocks[m_firstBlock].Size = m_capacity;
+		InsertFree(m_firstBlock);
+	}
+}
+
+void TlsfAllocator::Mapping(uint64_t units, uint32_t& fl, uint32_t& sl)
+{
+	if (units < SL_COUNT)
+	{
+		// 작은 크기는 크기마다 버킷 하나
+		fl = 0;
+		sl = static_cast<uint32_t>(units);
+		return;
+	}
+
+	const uint32_t log = Log2(units);
+	fl = log - SL_LOG2 + 1;
+	sl = static_cast<uint32_t>(units >> (log - SL_LOG2)) - SL_COUNT;
+}
+
+TlsfAllocator::Handle TlsfAllocator::CreateBlock()
+{
+	if (m_unusedBlocks != INVALID_HANDLE)
+	{
+		const Handle handle = m_unusedBlocks;
+		m_unusedBlocks = m_blocks[handle].NextFree;
+		m_blocks[handle] = Block();
+		return handle;
+	}
+
+	m_blocks.emplace_back();
+	return static_cast<Handle>(m_blocks.size() - 1);
+}
+
+void TlsfAllocator::ReleaseBlock(Handle handle)
+{
+	m_blocks[handle].NextFree = m_unusedBlocks;
+	m_unusedBlocks = handle;
+}
+
+void TlsfAllocator::InsertFree(Handle handle)
+{
+	Block& block = m_blocks[handle];
+	uint32_t fl, sl;
+	Mapping(block.Size / m_granularity, fl, sl);
+
+	block.IsFree = true;
+	block.PrevFree = INVALID_HANDLE;
+	block.NextFree = m_freeLists[fl][sl];
+	if (block.NextFree != INVALID_HANDLE)
+	{
+		m_blocks[block.NextFree].PrevFree = handle;
+	}
+	m_freeLists[fl][sl] = handle;
+
+	m_flBitmap |= uint64_t(1) << fl;
+	m_slBitmaps[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::RemoveFree(Handle handle)
+{
+	Block& block = m_blocks[handle];
+	uint32_t fl, sl;
+	Mapping(block.Size / m_granularity, fl, sl);
+
+	if (block.PrevFree != INVALID_HANDLE) m_blocks[block.PrevFree].NextFree = block.NextFree;
+	else m_freeLists[fl][sl] = block.NextFree;
+	if (block.NextFree != INVALID_HANDLE) m_blocks[block.NextFree].PrevFree = block.PrevFree;
+
+	if (m_freeLists[fl][sl] == INVALID_HANDLE)
+	{
+		m_slBitmaps[fl] &= ~(1u << sl);
+		if (m_slBitmaps[fl] == 0) m_flBitmap &= ~(uint64_t(1) << fl);
+	}
+
+	block.IsFree = false;
+	block.PrevFree = block.NextFree = INVALID_HANDLE;
+}
+
+TlsfAllocator::Handle TlsfAllocator::FindFree(uint64_t units) const
+{
+	// 다음 버킷부터 찾으면 버킷 안의 어떤 블록을 골라도 크기가 충분합니다. (Good-fit)
+	uint64_t searchUnits = units;
+	if (units >= SL_COUNT)
+	{
+		searchUnits += (uint64_t(1) << (Log2(units) - SL_LOG2)) - 1;
+	}
+
+	uint32_t fl, sl;
+	Mapping(searchUnits, fl, sl);
+
+	if (fl < FL_COUNT)
+	{
+		uint32_t slMap = (sl < SL_COUNT) ? (m_slBitmaps[fl] & (~0u << sl)) : 0;
+		if (slMap == 0)
+		{
+			const uint64_t flMap = (fl + 1 < 64) ? (m_flBitmap & (~uint64_t(0) << (fl + 1))) : 0;
+			if (flMap != 0)
+			{
+				fl = static_cast<uint32_t>(std::countr_zero(flMap));
+				slMap = m_slBitmaps[fl];
+			}
+		}
+
+		if (slMap != 0)
+		{
+			return m_freeLists[fl][std::countr_zero(slMap)];
+		}
+	}
+
+	// 더 큰 버킷이 없으면, 요청 크기가 속한 버킷 안에서 딱 맞는 블록을 직접 찾습니다.
+	Mapping(units, fl, sl);
+	for (Handle handle = m_freeLists[fl][sl]; handle != INVALID_HANDLE; handle = m_blocks[handle].NextFree)
+	{
+		if (m_blocks[handle].Size >= units * m_granularity) return handle;
+	}
+	return INVALID_HANDLE;
+}
+
+TlsfAllocator::Allocation TlsfAllocator::Allocate(uint64_t size, uint64_t alignment)
+{
+	size = AlignUp((std::max)(size, uint64_t(1)), m_granularity);
+	alignment = (std::max)(alignment, m_granularity);
+	if (size > m_capacity) return {};
+
+	// 정렬 패딩이 최대한 생겨도 들어가는 크기로 찾습니다.
+	const uint64_t searchSize = size + (alignment - m_granularity);
+	Handle handle = FindFree(searchSize / m_granularity);
+
+	if (handle == INVALID_HANDLE && alignment > m_granularity)
+	{
+		// 패딩이 필요 없는 블록이 있을 수 있으므로 크기만으로 한 번 더 찾아 확인합니다.
+		handle = FindFree(size / m_granularity);
+		if (handle != INVALID_HANDLE)
+		{
+			const Block& block = m_blocks[handle];
+			if (AlignUp(block.Offset, alignment) + size > block.Offset + block.Size) handle = INVALID_HANDLE;
+		}
+	}
+
+	if (handle == INVALID_HANDLE) return {};
+
+	RemoveFree(handle);
+	return AllocateFromBlock(handle, size, alignment);
+}
+
+TlsfAllocator::Allocation TlsfAllocator::AllocateFromBlock(Handle handle, uint64_t size, uint64_t alignment)
+{
+	// 앞쪽 정렬 패딩을 빈 블록으로 떼어 냅니다. (앞 이웃은 사용 중이므로 합칠 필요 없음)
+	const uint64_t padding = AlignUp(m_blocks[handle].Offset, alignment) - m_blocks[handle].Offset;
+	if (padding > 0)
+	{
+		const Handle front = CreateBlock();
+		Block& block = m_blocks[handle];
+		Block& frontBlock = m_blocks[front];
+
+		frontBlock.Offset = block.Offset;
+		frontBlock.Size = padding;
+		frontBlock.PrevPhysical = block.PrevPhysical;
+		frontBlock.NextPhysical = handle;
+		if (frontBlock.PrevPhysical != INVALID_HANDLE) m_blocks[frontBlock.PrevPhysical].NextPhysical = front;
+		else m_firstBlock = front;
+
+		block.Offset += padding;
+		block.Size -= padding;
+		block.PrevPhysical = front;
+		InsertFree(front);
+	}
+
+	// 남는 뒤쪽을 빈 블록으로 떼어 냅니다.
+	if (m_blocks[handle].Size > size)
+	{
+		const Handle back = CreateBlock();
+		Block& block = m_blocks[handle];
+		Block& backBlock = m_blocks[back];
+
+		backBlock.Offset = block.Offset + size;
+		backBlock.Size = block.Size - size;
+		backBlock.PrevPhysical = handle;
+		backBlock.NextPhysical = block.NextPhysical;
+		if (backBlock.NextPhysical != INVALID_HANDLE) m_blocks[backBlock.NextPhysical].PrevPhysical = back;
+
+		block.Size = size;
+		block.NextPhysical = back;
+		InsertFree(back);
+	}
+
+	Block& block = m_blocks[handle];
+	block.IsFree = false;
+	block.Alignment = alignment;
+
+	m_usedBytes += block.Size;
+	++m_allocationCount;
+
+	Allocation allocation;
+	allocation.Offset = block.Offset;
+	allocation.Size = block.Size;
+	allocation.Block = handle;
+	return allocation;
+}
+
+void TlsfAllocator::Free(const Allocation& allocation)
+{
+	if (!allocation.IsValid()) return;
+
+	Handle handle = allocation.Block;
+	m_usedBytes -= m_blocks[handle].Size;
+	--m_allocationCount;
+
+	// 앞 이웃이 비어 있으면 합칩니다.
+	const Handle prev = m_blocks[handle].PrevPhysical;
+	if (prev != INVALID_HANDLE && m_blocks[prev].IsFree)
+	{
+		RemoveFree(prev);
+		Block& prevBlock = m_blocks[prev];
+		const Block& block = m_blocks[handle];
+
+		prevBlock.Size += block.Size;
+		prevBlock.NextPhysical = block.NextPhysical;
+		if (block.NextPhysical != INVALID_HANDLE) m_blocks[block.NextPhysical].PrevPhysical = prev;
+
+		ReleaseBlock(handle);
+		handle = prev;
+	}
+
+	// 뒤 이웃이 비어 있으면 합칩니다.
+	const Handle next = m_blocks[handle].NextPhysical;
+	if (next != INVALID_HANDLE && m_blocks[next].IsFree)
+	{
+		RemoveFree(next);
+		Block& block = m_blocks[handle];
+		const Block& nextBlock = m_blocks[next];
+
+		block.Size += nextBlock.Size;
+		block.NextPhysical = nextBlock.NextPhysical;
+		if (nextBlock.NextPhysical != INVALID_HANDLE) m_blocks[nextBlock.NextPhysical].PrevPhysical = handle;
+
+		ReleaseBlock(next);
+	}
+
+	InsertFree(handle);
+}
+
+std::vector<TlsfAllocator::Move> TlsfAllocator::PlanDefragmentation(uint64_t maxBytes)
+{
+	std::vector<Move> moves;
+
+	// 사용 중인 블록을 오프셋 역순으로 모읍니다. (뒤쪽부터 비워야 끝에 큰 빈 공간이 생김)
+	std::vector<Handle> used;
+	for (Handle handle = m_firstBlock; handle != INVALID_HANDLE; handle = m_blocks[handle].NextPhysical)
+	{
+		if (!m_blocks[handle].IsFree) used.push_back(handle);
+	}
+
+	uint64_t movedBytes = 0;
+	for (auto it = used.rbegin(); it != used.rend(); ++it)
+	{
+		const Handle sourceHandle = *it;
+		const uint64_t size = m_blocks[sourceHandle].Size;
+		const uint64_t alignment = m_blocks[sourceHandle].Alignment;
+		const uint64_t sourceOffset = m_blocks[sourceHandle].Offset;
+		if (movedBytes + size > maxBytes) break;
+
+		// 자신보다 앞에 있는 첫 번째 맞는 빈 블록 (First-fit: 앞쪽으로 모이도록)
+		Handle target = INVALID_HANDLE;
+		for (Handle handle = m_firstBlock; handle != INVALID_HANDLE; handle = m_blocks[handle].NextPhysical)
+		{
+			const Block& block = m_blocks[handle];
+			if (block.Offset >= sourceOffset) break;
+			if (block.IsFree && AlignUp(block.Offset, alignment) + size <= block.Offset + block.Size)
+			{
+				target = handle;
+				break;
+			}
+		}
+		if (target == INVALID_HANDLE) continue;
+
+		Move move;
+		move.Source.Offset = sourceOffset;
+		move.Source.Size = size;
+		move.Source.Block = sourceHandle;
+
+		RemoveFree(target);
+		move.Destination = AllocateFromBlock(target, size, alignment);
+
+		moves.push_back(move);
+		movedBytes += size;
+	}
+
+	return moves;
+}
+
+TlsfAllocator::Stats TlsfAllocator::GetStats() const
+{
+	Stats stats;
+	stats.Capacity = m_capacity;
+	stats.UsedBytes = m_usedBytes;
+	stats.FreeBytes = m_capacity - m_usedBytes;
+	stats.AllocationCount = m_allocationCount;
+
+	for (Handle handle = m_firstBlock; handle != INVALID_HANDLE; handle = m_blocks[handle].NextPhysical)
+	{
+		const Block& block = m_blocks[handle];
+		if (!block.IsFree) continue;
+
+		++stats.FreeBlockCount;
+		stats.LargestFreeBlock = (std::max)(stats.LargestFreeBlock, block.Size);
+	}
+	return stats;
+}
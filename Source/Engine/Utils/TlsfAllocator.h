@@ -0,0 +1,117 @@
+// TlsfAllocator.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * [TlsfAllocator]
+ * [0, capacity) 범위의 오프셋만 관리하는 TLSF(Two-Level Segregated Fit) 할당기입니다.
+ * 실제 메모리는 건드리지 않으므로 GPU 힙 하나를 잘라 쓰는 장부로 씁니다. (D3D12MemoryAllocator)
+ * - 빈 블록을 크기별 2단계 버킷(2의 거듭제곱 x 16등분)에 나눠 두고, 비트맵으로 O(1)에 맞는 버킷을 찾습니다.
+ * - 해제하면 물리적으로 이웃한 빈 블록과 바로 합치므로 빈 블록끼리 붙어 있는 일은 없습니다.
+ * - 모든 크기/정렬은 granularity 단위로 올림합니다. (정렬은 2의 거듭제곱)
+ *
+ * 조각 모음 훅: PlanDefragmentation은 뒤쪽 할당을 앞쪽 빈 공간으로 옮길 목적지를 미리 잡아 줍니다.
+ * 호출자가 데이터를 옮긴 뒤 원래 할당(Source)을 Free하면 뒤쪽이 비워집니다.
+ *
+ * 스레드 안전하지 않습니다. 필요하면 소유자가 잠그세요.
+ */
+class TlsfAllocator
+{
+public:
+	using Handle = uint32_t;
+	static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+
+	struct Allocation
+	{
+		uint64_t Offset = 0;
+		uint64_t Size = 0; // granularity로 올림한 크기
+		Handle Block = INVALID_HANDLE;
+
+		bool IsValid() const { return Block != INVALID_HANDLE; }
+	};
+
+	struct Stats
+	{
+		uint64_t Capacity = 0;
+		uint64_t UsedBytes = 0;
+		uint64_t FreeBytes = 0;
+		uint64_t LargestFreeBlock = 0;
+		uint32_t AllocationCount = 0;
+		uint32_t FreeBlockCount = 0;
+
+		// 0이면 빈 공간이 한 덩어리, 1에 가까울수록 잘게 흩어져 큰 할당이 실패하기 쉬움
+		float GetFragmentation() const
+		{
+			return FreeBytes ? 1.0f - static_cast<float>(LargestFreeBlock) / static_cast<float>(FreeBytes) : 0.0f;
+		}
+	};
+
+	// 조각 모음으로 옮길 할당 하나. Destination은 이미 잡혀 있고, Source는 호출자가 옮긴 뒤 Free합니다.
+	struct Move
+	{
+		Allocation Source;
+		Allocation Destination;
+	};
+
+	TlsfAllocator(uint64_t capacity, uint64_t granularity = 256);
+
+	// 실패하면 IsValid()가 false인 할당을 돌려줍니다. (예외 없음: 호출자가 다른 힙을 시도)
+	Allocation Allocate(uint64_t size, uint64_t alignment = 0);
+	void Free(const Allocation& allocation);
+
+	// 뒤쪽 할당부터, 그보다 앞에 들어갈 빈 블록이 있으면 목적지를 잡습니다. 옮길 총량은 maxBytes까지.
+	std::vector<Move> PlanDefragmentation(uint64_t maxBytes);
+
+	Stats GetStats() const;
+	uint64_t GetCapacity() const { return m_capacity; }
+	uint64_t GetUsedBytes() const { return m_usedBytes; }
+	uint32_t GetAllocationCount() const { return m_allocationCount; }
+	bool IsEmpty() const { return m_allocationCount == 0; }
+
+private:
+	static constexpr uint32_t SL_LOG2 = 4;               // 2단계 분할 수 = 16
+	static constexpr uint32_t SL_COUNT = 1u << SL_LOG2;
+	static constexpr uint32_t FL_COUNT = 64 - SL_LOG2 + 1;
+
+	struct Block
+	{
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+		uint64_t Alignment = 0; // 사용 중일 때 요청된 정렬 (조각 모음 목적지를 고를 때 필요)
+		Handle PrevPhysical = INVALID_HANDLE;
+		Handle NextPhysical = INVALID_HANDLE;
+		Handle PrevFree = INVALID_HANDLE; // 미사용 블록은 풀의 빈 슬롯 연결에도 씀
+		Handle NextFree = INVALID_HANDLE;
+		bool IsFree = false;
+	};
+
+	// units(granularity 단위 크기)가 속한 버킷
+	static void Mapping(uint64_t units, uint32_t& fl, uint32_t& sl);
+
+	Handle CreateBlock();
+	void ReleaseBlock(Handle handle);
+
+	void InsertFree(Handle handle);
+	void RemoveFree(Handle handle);
+	Handle FindFree(uint64_t units) const;
+
+	// 빈 블록 handle에서 [정렬된 시작, +size)를 잘라 사용 중으로 만듭니다. (앞뒤 남는 부분은 빈 블록으로)
+	Allocation AllocateFromBlock(Handle handle, uint64_t size, uint64_t alignment);
+
+	uint64_t m_capacity;
+	uint64_t m_granularity;
+
+	std::vector<Block> m_blocks;
+	Handle m_unusedBlocks = INVALID_HANDLE; // 다시 쓸 수 있는 Block 슬롯
+	Handle m_firstBlock = INVALID_HANDLE;   // 오프셋 0의 블록 (물리 순서의 시작)
+
+	uint64_t m_flBitmap = 0;
+	uint32_t m_slBitmaps[FL_COUNT] = {};
+	Handle m_freeLists[FL_COUNT][SL_COUNT];
+
+	uint64_t m_usedBytes = 0;
+	uint32_t m_allocationCount = 0;
+};
@@ -13,7 +13,7 @@ Window::Window(HINSTANCE hInstance, const WCHAR* title, UINT width, UINT height)
     m_title(title),
     m_className(L"MyEngineWindowClass")
 {
-    // [] и ϵ 
+    // [수정] 실패를 감지하도록 변경
     if (!MyRegisterClass(hInstance))
     {
         throw std::runtime_error("Failed to register window class.");
@@ -70,22 +70,22 @@ BOOL Window::InitInstance(int nCmdShow)
     return TRUE;
 }
 
-// 'main.cpp' GameApp ִ Լ
+// 'main.cpp'가 GameApp을 연결해주는 함수
 void Window::SetApp(D3D12App* pApp)
 {
     m_d3dApp = pApp;
 }
 
-//    ( ߿)
+// 메인 루프 수정 (가장 중요)
 void Window::Run()
 {
     MSG msg = {};
 
-    // Ÿ̸Ӵ D3D12App ƴ ' ' մϴ.
+    // 타이머는 D3D12App이 아닌 '메인 루프'가 소유합니다.
     Timer timer;
     timer.Reset();
 
-    // ⺻ ޽ Դϴ:
+    // 기본 메시지 루프입니다:
     while (msg.message != WM_QUIT)
     {
         if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
@@ -96,8 +96,8 @@ void Window::Run()
         }
         else
         {
-            // m_d3dApp->Render() ȣϴ  ƴ϶,
-            // Update Render  ȣؾ մϴ.
+            // m_d3dApp->Render()만 호출하는 것이 아니라,
+            // Update와 Render를 모두 호출해야 합니다.
             if (m_d3dApp)
             {
                 timer.Tick();
@@ -127,7 +127,7 @@ LRESULT Window::HandleMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPa
     {
         //PAINTSTRUCT ps;
         //HDC hdc = BeginPaint(hWnd, &ps);
-        //// TODO: ⿡ hdc ϴ ׸ ڵ带 ߰մϴ...
+        //// TODO: 여기에 hdc를 사용하는 그리기 코드를 추가합니다...
         //EndPaint(hWnd, &ps);
 
         ValidateRect(hWnd, NULL);
@@ -142,7 +142,7 @@ LRESULT Window::HandleMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPa
     return 0;
 }
 
-// ImGui  ν ڵ鷯  ( imgui_impl_win32.h extern Ǿ )
+// ImGui 윈도우 프로시저 핸들러 선언 (현재 imgui_impl_win32.h에 extern으로 선언되어 있음)
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 
@@ -15,18 +15,18 @@ public:
 
 	void Run();
 
-	// InitInstance() public Ͽ main ȣ
+	// InitInstance()를 public으로 변경하여 main에서 호출
 	BOOL InitInstance(int nCmdShow);
-	HWND GetHWND() const { return m_hWnd; } // HWND ȯϴ getter
+	HWND GetHWND() const { return m_hWnd; } // HWND를 반환하는 getter
 
-	// 'main.cpp' Window GameApp ˷  ִ 'Setter'
+	// 'main.cpp'가 Window에게 GameApp을 알려줄 수 있는 'Setter'
 	void SetApp(D3D12App* pApp);
 
 private:
 	HINSTANCE m_hInst;                                
 	HWND m_hWnd;
-	std::wstring m_title;                  //  ǥ ؽƮԴϴ.
-	std::wstring m_className;              // ⺻ â Ŭ ̸Դϴ.
+	std::wstring m_title;                  // 제목 표시줄 텍스트입니다.
+	std::wstring m_className;              // 기본 창 클래스 이름입니다.
 
 	UINT m_width;
 	UINT m_height;
@@ -35,7 +35,7 @@ private:
 
 	bool MyRegisterClass(HINSTANCE hInstance) const;
 
-	LRESULT HandleMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam); // ޽ ó Լ
+	LRESULT HandleMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam); // 메시지 처리 함수
 	static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 	static INT_PTR CALLBACK About(HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam);
 };
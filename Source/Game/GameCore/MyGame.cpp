@@ -1,13 +1,32 @@
 #include "MyGame.h"
 
 #include "Utils/Utils.h" // GetExeDirectory, ReadShaderBytecode
-#include "D3DX12/d3dx12.h" // CD3DX12
 
 #include "Components/Scene.h"
 #include "Components/GameObject.h"
 #include "Components/Camera.h"
+#include "Components/BoundsComponent.h"
+#include "Core/JobSystem.h"
+#include "RHI/UploadRingBuffer.h"
+#include "RHI/UploadService.h"
+#include "RHI/PipelineCache.h"
 
-// ڿ θ(D3D12App) ڸ ȣ
+// 이 태그가 붙은 오브젝트는 소프트웨어 오클루전 컬링의 가리개(Occluder)로 그려집니다.
+static const StringId OCCLUDER_TAG = "Occluder";
+
+// LOD 선택 시 허용하는 화면 공간 오차 (픽셀)
+static constexpr float LOD_PIXEL_ERROR = 1.5f;
+
+// 렌더 큐 정렬 키 필드 (지금은 레이어/패스/파이프라인/머티리얼이 하나씩이므로 메쉬 구간(LOD)과 깊이만 달라집니다)
+static constexpr uint32_t SCENE_LAYER = 0;
+static constexpr uint32_t OPAQUE_PASS = 0;
+static constexpr uint32_t DEFAULT_PIPELINE_ID = 0; // m_pipeline
+static constexpr uint32_t DEFAULT_MATERIAL_ID = 0;
+
+// 청크 하나가 최소한 맡을 인스턴스 묶음 수 (너무 잘게 나누면 리스트마다 드는 고정 비용이 더 큼)
+static constexpr size_t MIN_BATCHES_PER_RECORD_CHUNK = 64;
+
+// 생성자에서 부모(D3D12App) 생성자를 호출
 MyGame::MyGame(HINSTANCE hInstance)
 	: D3D12App(hInstance)
 {
@@ -16,152 +35,91 @@ MyGame::MyGame(HINSTANCE hInstance)
 
 MyGame::~MyGame()
 {
+	// 멤버(정점/인덱스 버퍼 등)가 파괴되기 전에 GPU를 비우고 OnShutdown을 부릅니다.
 	Shutdown();
 }
 
-// '' Ưȭ ҽ ʱȭմϴ.
-// (D3D12App::InitBase()   '' ȣ˴ϴ)
+// '게임'에 특화된 리소스를 초기화합니다.
+// (D3D12App::InitBase()가 성공적으로 끝난 '이후'에 호출됩니다)
 bool MyGame::Init(HWND hWnd, UINT width, UINT height)
 {
-	using namespace Microsoft::WRL;
-
-	InitBase(hWnd, width, height); // θ Ŭ InitBase ȣ
+	InitBase(hWnd, width, height); // 부모 클래스의 InitBase 호출
 
 	// Load Shaders
 	auto dir = GetExeDirectoryWstring();
 	auto vsBytecode = ReadShaderBytecode(dir + L"\\SimpleVS.cso");
 	auto psBytecode = ReadShaderBytecode(dir + L"\\SimplePS.cso");
 
-	D3D12_SHADER_BYTECODE vertexShaderBytecode = {};
-	vertexShaderBytecode.pShaderBytecode = vsBytecode.data();
-	vertexShaderBytecode.BytecodeLength = vsBytecode.size();
-
-	D3D12_SHADER_BYTECODE pixelShaderBytecode = {};
-	pixelShaderBytecode.pShaderBytecode = psBytecode.data();
-	pixelShaderBytecode.BytecodeLength = psBytecode.size();
-
 	Debug::Print(L"Shader Bytecode Load Complete!");
 
-	D3D12_ROOT_PARAMETER rootParameter = {};
-	rootParameter.ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
-	rootParameter.Descriptor.RegisterSpace = 0;
-	rootParameter.Descriptor.ShaderRegister = 0; // b0 
-	rootParameter.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
-
-	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc = {};
-	rootSignatureDesc.NumParameters = 1;
-	rootSignatureDesc.pParameters = &rootParameter;
-	rootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-
-	ComPtr<ID3DBlob> signature;
-	ComPtr<ID3DBlob> error;
-	ThrowIfFailed(D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error));
-	ThrowIfFailed(m_device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), IID_PPV_ARGS(&m_rootSignature)));
-
-	Debug::Print(L"Root Signature Load Complete!");
-
-	// Create Pipeline State Object(PSO)
-	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-	psoDesc.pRootSignature = m_rootSignature.Get();
-	psoDesc.VS = vertexShaderBytecode;
-	psoDesc.PS = pixelShaderBytecode;
-
-	// ... (RasterizerState, BlendState)
-	psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-	psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-	psoDesc.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-
-	// Input Layout
-	D3D12_INPUT_ELEMENT_DESC inputLayout[] =
-	{
-		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(Vertex, Position), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-		{ "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(Vertex, Normal),   D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,    0, offsetof(Vertex, TexCoord), D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-		{ "TANGENT",  0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(Vertex, Tangent),  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-		{ "BITANGENT",0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(Vertex, Bitangent),D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+	// Create Pipeline (Root Signature + PSO)
+	// 루트 시그니처는 RHI가 설명의 개수대로 만들어 줍니다. 여기서는 CBV 없이 루트 SRV 1개(t0, 인스턴스 StructuredBuffer)뿐입니다.
+	const RHIInputElement inputLayout[] =
+	{
+		{ "POSITION", 0, RHIFormat::R32G32B32_Float, 0, offsetof(Vertex, Position) },
+		{ "NORMAL",   0, RHIFormat::R32G32B32_Float, 0, offsetof(Vertex, Normal) },
+		{ "TEXCOORD", 0, RHIFormat::R32G32_Float,    0, offsetof(Vertex, TexCoord) },
+		{ "TANGENT",  0, RHIFormat::R32G32B32_Float, 0, offsetof(Vertex, Tangent) },
+		{ "BITANGENT",0, RHIFormat::R32G32B32_Float, 0, offsetof(Vertex, Bitangent) },
 	};
-	psoDesc.InputLayout = { inputLayout, _countof(inputLayout) };
 
-	psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-	psoDesc.NumRenderTargets = 1;
-	// m_renderTargetBuffers θ Ŭ(D3D12App)
-	// 'protected' Ǿ Ƿ ڽ Ŭ  մϴ.
+	RHIGraphicsPipelineDesc pipelineDesc;
+	pipelineDesc.VertexShader = { vsBytecode.data(), vsBytecode.size() };
+	pipelineDesc.PixelShader = { psBytecode.data(), psBytecode.size() };
+	pipelineDesc.InputLayout = inputLayout;
+	pipelineDesc.InputElementCount = _countof(inputLayout);
+	pipelineDesc.ConstantBufferCount = 0;
+	pipelineDesc.ShaderResourceCount = 1; // t0: 인스턴스별 WVP (StructuredBuffer)
 #if defined(_EDITOR_MODE)
-	//psoDesc.RTVFormats[0] = m_renderTargetBuffers[0]->GetDesc().Format;
-	psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+	pipelineDesc.RenderTargetFormat = RHIFormat::R8G8B8A8_UNorm_sRGB; // 에디터 RTT 포맷
 #else
-	psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
+	pipelineDesc.RenderTargetFormat = RHIFormat::R8G8B8A8_UNorm;
 #endif
-	psoDesc.SampleMask = UINT_MAX;
-	psoDesc.SampleDesc.Count = 1;
-	
-	// DSV ˵ ؾ մϴ.
-	psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
-	
-	//  ׽Ʈ Ѿ մϴ.
-	psoDesc.DepthStencilState.DepthEnable = TRUE;
-	psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-	psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-
-
-	ThrowIfFailed(m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_pso)));
+	pipelineDesc.DepthStencilFormat = RHIFormat::D32_Float;
+	pipelineDesc.CullMode = RHICullMode::Back;
+
+	// 캐시가 설명 전체의 해시로 중복을 걸러내고, 지난 실행에 컴파일한 것은 디스크 라이브러리에서 꺼냅니다.
+	m_pipeline = m_pipelineCache->GetOrCreate(pipelineDesc);
 	Debug::Print(L"Pipeline State Object Load Complete!");
 
 	// Load Model Data
-	m_modelManager.LoadModel("Dragon 2.5_fbx.fbx", m_vertices, m_indices);
-	Debug::Print(L"Model Load Complete! Vertex Count: " + std::to_wstring(m_vertices.size()) + L", Index Count: " + std::to_wstring(m_indices.size()));
-
-	// Create Vertex Buffer
-	UINT vbSize = static_cast<UINT>(m_vertices.size() * sizeof(Vertex));
-	CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_UPLOAD);
-	CD3DX12_RESOURCE_DESC vbDesc = CD3DX12_RESOURCE_DESC::Buffer(vbSize);
-
-	ThrowIfFailed(m_device->CreateCommittedResource(
-		&heapProps, D3D12_HEAP_FLAG_NONE, &vbDesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_vertexBuffer))
-	);
-	void* vbData;
-	m_vertexBuffer->Map(0, nullptr, &vbData);
-	memcpy(vbData, m_vertices.data(), vbSize);
-	m_vertexBuffer->Unmap(0, nullptr);
-
-	m_vbView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
-	m_vbView.SizeInBytes = vbSize;
-	m_vbView.StrideInBytes = sizeof(Vertex);
-
-	// Create Index Buffer
-	UINT ibSize = static_cast<UINT>(m_indices.size() * sizeof(UINT));
-	CD3DX12_RESOURCE_DESC ibDesc = CD3DX12_RESOURCE_DESC::Buffer(ibSize);
-	ThrowIfFailed(m_device->CreateCommittedResource(
-		&heapProps, D3D12_HEAP_FLAG_NONE, &ibDesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_indexBuffer))
-	);
-	void* ibData;
-	m_indexBuffer->Map(0, nullptr, &ibData);
-	memcpy(ibData, m_indices.data(), ibSize);
-	m_indexBuffer->Unmap(0, nullptr);
-
-	m_ibView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
-	m_ibView.SizeInBytes = ibSize;
-	m_ibView.Format = DXGI_FORMAT_R32_UINT;
-
-	// Create CBV for WVP matrix
-	const UINT constantBufferSize = (sizeof(XMMATRIX) + 255) & ~255; // 256Ʈ 
-	
-	// ε  (CPU write, GPU Read) 
-	auto cbHeapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-	auto cbDesc = CD3DX12_RESOURCE_DESC::Buffer(constantBufferSize);
-
-	ThrowIfFailed(m_device->CreateCommittedResource(
-		&cbHeapProps,
-		D3D12_HEAP_FLAG_NONE,
-		&cbDesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		IID_PPV_ARGS(&m_constantBuffer))
-	);
-
-	ThrowIfFailed(m_constantBuffer->Map(0, nullptr, reinterpret_cast<void**>(&m_pCbvDataBegin)));
+	m_modelManager.LoadModel("Dragon 2.5_fbx.fbx", m_vertices, m_indices, m_subMeshes, m_meshBounds, m_lodLevels);
+	Debug::Print(L"Model Load Complete! Vertex Count: " + std::to_wstring(m_vertices.size()) + L", Index Count: " + std::to_wstring(m_indices.size()) +
+		L", SubMesh Count: " + std::to_wstring(m_subMeshes.size()) + L", LOD Count: " + std::to_wstring(m_lodLevels.size()));
+	for (size_t i = 0; i < m_lodLevels.size(); ++i)
+	{
+		Debug::Print(L"  LOD " + std::to_wstring(i) + L": Triangles " + std::to_wstring(m_lodLevels[i].IndexCount / 3) +
+			L", Error " + std::to_wstring(m_lodLevels[i].GeometricError));
+	}
+
+	// 피킹/시야 판정용 삼각형 BVH (LOD 0 기준, 같은 메쉬를 쓰는 오브젝트가 공유)
+	if (!m_vertices.empty() && !m_lodLevels.empty())
+	{
+		m_meshBVH.Build(&m_vertices[0].Position, sizeof(Vertex), m_vertices.size(),
+			m_indices.data() + m_lodLevels[0].IndexStart, m_lodLevels[0].IndexCount);
+		Debug::Print(L"Mesh BVH Build Complete! Nodes: " + std::to_wstring(m_meshBVH.GetNodeCount()));
+	}
+
+	// Create Vertex / Index Buffer
+	// Default 힙에 만들고 Copy 큐로 올립니다. 두 복사는 한 번에 제출되고, 첫 Render()의 Flush가 Direct 큐를 기다리게 합니다.
+	const uint64_t vbSize = m_vertices.size() * sizeof(Vertex);
+	m_vertexBuffer = m_uploadService->CreateBuffer(m_vertices.data(), vbSize);
+
+	const uint64_t ibSize = m_indices.size() * sizeof(UINT);
+	m_indexBuffer = m_uploadService->CreateBuffer(m_indices.data(), ibSize);
+
+#if defined(_RUN_BENCHMARKS)
+	// Transform 일괄 계산 마이크로 벤치마크 (스칼라 vs SIMD)
+	const size_t benchmarkCounts[] = { 1000, 10000, 100000 };
+	for (size_t count : benchmarkCounts)
+	{
+		TransformBatch::BenchmarkResult result = TransformBatch::RunBenchmark(count, 50);
+		Debug::Print(L"[TransformBatch] Count: " + std::to_wstring(result.Count) +
+			L", Scalar: " + std::to_wstring(result.ScalarMs) + L"ms" +
+			L", SIMD: " + std::to_wstring(result.SimdMs) + L"ms" +
+			L", MaxError: " + std::to_wstring(result.MaxError));
+	}
+#endif // _RUN_BENCHMARKS
 
 	// Create Scene and Main Camera
 	m_activeScene = std::make_unique<Scene>("Main Scene");
@@ -176,69 +134,442 @@ bool MyGame::Init(HWND hWnd, UINT width, UINT height)
 		gameCam->Init();
 
 		m_activeScene->SetMainCamera(gameCam);
-		m_gameCamera = gameCam; // θ Ŭ  ͵ 
+		m_gameCamera = gameCam; // 부모 클래스의 멤버 포인터도 설정
 		Debug::Print(L"Main Camera Created in Scene!");
 
-		m_activeScene->CreateGameObject("Player");
-		m_activeScene->CreateGameObject("Ground");
+		// 임포트 시 계산된 바운딩 볼륨을 들고 있는 오브젝트만 렌더링 대상입니다.
+		m_activeScene->CreateGameObject("Player")->AddComponent<BoundsComponent>(m_meshBounds)->SetMeshBVH(&m_meshBVH);
+
+		GameObject* ground = m_activeScene->CreateGameObject("Ground");
+		ground->AddComponent<BoundsComponent>(m_meshBounds)->SetMeshBVH(&m_meshBVH);
+		ground->SetTag(OCCLUDER_TAG); // 오클루전 컬링의 가리개로 사용
 	}
 
-	return true; // ʱȭ 
+	return true; // 초기화 성공
 }
 
-// ' ' Ʈ. D3D12App::Run()     ȣ˴ϴ.
+// '게임 로직' 업데이트. D3D12App::Run()의 메인 루프에서 매 프레임 호출됩니다.
 void MyGame::Update(float deltaTime)
 {
 	m_activeScene->Update(deltaTime);
 }
 
-// '׸' . D3D12App::Render() ο ȣ˴ϴ.
-//  RTV/DSV , Ʈ/  ' ' ȣ˴ϴ.
-void MyGame::Render3DScene(const Camera& camera)
+// 이번 프레임의 모든 뷰를 준비합니다. D3D12App::Render()가 Render3DScene보다 먼저 한 번 호출합니다.
+// 1) 뷰와 무관한 추출(월드 행렬, 월드 바운딩 볼륨)은 한 번만 하고,
+// 2) 뷰별 컬링/LOD/드로우 리스트 구성은 워커 스레드에서 뷰마다 병렬로 합니다.
+void MyGame::PrepareViews(const RenderView* views, size_t viewCount)
 {
-	// [] PSO, RootSig 
-	m_commandList->SetGraphicsRootSignature(m_rootSignature.Get());
-	m_commandList->SetPipelineState(m_pso.Get());
+	for (auto& [camera, data] : m_viewRenderData)
+	{
+		data.DrawList.clear();
+		data.Instanced.Instances.clear();
+		data.Instanced.Batches.clear();
+	}
+
+	if (!m_activeScene || m_lodLevels.empty() || viewCount == 0) return;
 
-	// [] ҽ ε (ECS RenderSystem  ۾  Դϴ)
-	m_commandList->IASetVertexBuffers(0, 1, &m_vbView); //   
-	m_commandList->IASetIndexBuffer(&m_ibView); // ε  
-	m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	ExtractFrame();
+
+	// 맵 삽입은 메인 스레드에서 끝내 두고, 워커는 자기 뷰의 데이터만 씁니다.
+	m_preparedViews.clear();
+	for (size_t i = 0; i < viewCount; ++i)
+	{
+		if (views[i].ViewCamera)
+		{
+			m_preparedViews.emplace_back(views[i], &m_viewRenderData[views[i].ViewCamera]);
+		}
+	}
+
+	m_jobSystem->ParallelFor(m_preparedViews.size(), 1, [this](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			BuildViewDrawList(m_preparedViews[i].first, *m_preparedViews[i].second);
+		}
+	});
+
+	// 링 버퍼는 스레드 안전하지 않으므로 인스턴스 데이터 업로드는 메인 스레드에서 뷰마다 한 번에 합니다.
+	// 그래야 Render3DScene을 여러 스레드에서 청크로 나눠 기록할 때 주소만 읽으면 됩니다.
+	for (auto& prepared : m_preparedViews)
+	{
+		UploadInstances(*m_frameUploadRing, prepared.second->Instanced);
+	}
+}
 
-	XMMATRIX viewMatrix = camera.GetViewMatrix();
-	XMMATRIX projMatrix = camera.GetProjectionMatrix();
+// [프레임 추출] 렌더링 대상(BoundsComponent가 있는 오브젝트)의 월드 행렬과 바운딩 볼륨을 한 번만 모읍니다.
+void MyGame::ExtractFrame()
+{
+	// Update 이후 에디터에서 바뀐 Transform이 있을 수 있으므로, 워커가 읽기만 하도록 먼저 캐시를 갱신합니다.
+	// 공간 인덱스도 같이 맞춰야 합니다. 전체 재검사는 트리로 후보를 고르므로, 낡은 프록시 밖으로 나간 오브젝트는
+	// 후보에서 빠진 채 '안 보임'으로 캐시되고, 다시 움직이기 전까지 계속 컬링됩니다.
+	m_activeScene->FlushDirtyTransforms();
+	m_activeScene->UpdateSpatialIndex();
 
-	if (!m_activeScene) return;
+	m_extractedObjects.clear();
+	m_extractedIndexOf.clear();
 
 	for (const auto& gameObject : m_activeScene->GetGameObjects())
 	{
-		//  Ʈ ȯ  ɴϴ.
-		XMMATRIX worldMatrix = gameObject->GetTransform()->GetWorldMatrix();
+		if (!gameObject->GetComponent<BoundsComponent>()) continue;
+
+		m_extractedIndexOf.emplace(gameObject.get(), static_cast<uint32_t>(m_extractedObjects.size()));
+		m_extractedObjects.push_back({ gameObject.get() });
+	}
+
+	m_worldSpheres.Resize(m_extractedObjects.size());
+	m_worldAabbs.Resize(m_extractedObjects.size());
+
+	// 오브젝트마다 독립적인 캐시만 건드리므로 나눠서 처리할 수 있습니다.
+	m_jobSystem->ParallelFor(m_extractedObjects.size(), 256, [this](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			ExtractedObject& extracted = m_extractedObjects[i];
+			GameObject* object = extracted.Object;
+			const MeshBounds& bounds = object->GetComponent<BoundsComponent>()->GetWorldBounds();
+
+			const Transform* transform = object->GetTransform();
+			extracted.World = transform->GetWorldMatrix4x4();
+			extracted.Position = transform->GetPosition();
+			extracted.Rotation = transform->GetRotation();
+			extracted.Scale = transform->GetScale();
+			extracted.WorldScale = (m_meshBounds.Sphere.Radius > 0.0f) ? bounds.Sphere.Radius / m_meshBounds.Sphere.Radius : 1.0f;
+			extracted.IsOccluder = (object->GetTag() == OCCLUDER_TAG) && !m_vertices.empty();
+			extracted.TransformVersion = transform->GetVersion();
+
+			m_worldSpheres.Set(i, bounds.Sphere.Center, bounds.Sphere.Radius);
+			m_worldAabbs.Set(i, bounds.Box.Center, bounds.Box.Extents);
+		}
+	});
+
+	// 가시성 캐시 전체에 영향을 주는 것들을 하나의 값으로 묶습니다. (FNV-1a)
+	// 가리개가 움직이거나 바뀌면 가려진 결과를 모두 믿을 수 없고,
+	// 오브젝트가 파괴되면 풀 슬롯(주소)이 재사용될 수 있습니다.
+	uint64_t stamp = 14695981039346656037ull;
+	auto mix = [&stamp](uint64_t value) { stamp = (stamp ^ value) * 1099511628211ull; };
+
+	mix(m_activeScene->GetDestroyGeneration());
+	mix(m_occlusionCullingEnabled ? 1 : 0);
+	for (const ExtractedObject& extracted : m_extractedObjects)
+	{
+		if (!extracted.IsOccluder) continue;
+
+		mix(reinterpret_cast<uintptr_t>(extracted.Object));
+		mix(extracted.TransformVersion);
+	}
+	m_visibilityStamp = stamp;
+}
+
+// [뷰별] 컬링 -> 오클루전 -> LOD 선택 -> WVP 계산까지 해서 드로우 리스트를 만듭니다. (워커 스레드에서 실행)
+void MyGame::BuildViewDrawList(const RenderView& view, ViewRenderData& data) const
+{
+	const CameraViewData& viewData = view.ViewCamera->GetViewData();
+	const BoundingSphereStreams allSpheres = m_worldSpheres.GetStreams();
+
+	// 1. 이번 프레임에 다시 검사할 오브젝트를 고릅니다.
+	//    카메라가 기준 자세 근처에 있으면 정적 오브젝트는 지난 결과를 그대로 쓰고, 움직였거나 새로 생긴 것만 검사합니다.
+	//    아니면 씬의 공간 인덱스(DynamicBVH)로 프러스텀과 겹치는 오브젝트를 모두 다시 검사합니다. (서브트리 단위로 걸러짐)
+	data.Visible.clear();
+	data.Candidates.clear();
+
+	const bool reuseVisibility = data.Visibility.BeginFrame(viewData, m_visibilityStamp);
+	if (reuseVisibility)
+	{
+		for (uint32_t index = 0; index < m_extractedObjects.size(); ++index)
+		{
+			const ExtractedObject& extracted = m_extractedObjects[index];
+
+			bool visible = false;
+			if (!data.Visibility.TryGet(extracted.Object, extracted.TransformVersion, visible))
+			{
+				data.Candidates.push_back(index);
+			}
+			else if (visible)
+			{
+				data.Visible.push_back(index);
+			}
+		}
+	}
+	else
+	{
+		const DynamicBVH& spatialIndex = m_activeScene->GetSpatialIndex();
+		spatialIndex.QueryFrustum(viewData.FrustumPlanes, FRUSTUM_PLANE_COUNT, [&](int32_t proxyId)
+		{
+			auto it = m_extractedIndexOf.find(static_cast<const GameObject*>(spatialIndex.GetUserData(proxyId)));
+			if (it != m_extractedIndexOf.end()) data.Candidates.push_back(it->second);
+			return true;
+		});
+	}
+
+	// 2. SIMD 스피어 컬링 (트리는 여유 있는 Fat AABB를 쓰므로 추출해 둔 월드 바운딩 스피어로 정밀하게)
+	//    결과는 후보 인덱스이므로 추출 인덱스로 되돌립니다.
+	data.CandidateSpheres.Resize(data.Candidates.size());
+	for (size_t i = 0; i < data.Candidates.size(); ++i)
+	{
+		const uint32_t index = data.Candidates[i];
+		data.CandidateSpheres.Set(i, { allSpheres.CenterX[index], allSpheres.CenterY[index], allSpheres.CenterZ[index] }, allSpheres.Radius[index]);
+	}
+
+	FrustumCulling::CullSpheres(viewData, data.CandidateSpheres.GetStreams(), data.Tested);
+	for (uint32_t& index : data.Tested)
+	{
+		index = data.Candidates[index];
+	}
+
+	// 2-1. 소프트웨어 오클루전 컬링: "Occluder" 태그 오브젝트를 저해상도 깊이 버퍼에 그리고,
+	//      나머지는 월드 AABB를 계층 깊이와 비교해 완전히 가려진 것을 뺍니다.
+	//      다시 검사할 오브젝트가 없으면 가리개를 그릴 필요도 없습니다.
+	if (m_occlusionCullingEnabled && !data.Tested.empty())
+	{
+		data.Occlusion.BeginFrame(viewData.ViewProjection);
+		data.OcclusionCandidates.clear();
+		data.Occluders.clear();
+
+		auto rasterizeOccluder = [&](uint32_t index)
+		{
+			data.Occlusion.RasterizeOccluder(m_extractedObjects[index].World,
+				&m_vertices[0].Position, sizeof(Vertex), m_vertices.size(), m_indices.data(), m_lodLevels[0].IndexCount);
+		};
+
+		// 캐시에서 보인다고 나온 가리개도 깊이 버퍼에는 그려야 합니다.
+		for (uint32_t index : data.Visible)
+		{
+			if (m_extractedObjects[index].IsOccluder) rasterizeOccluder(index);
+		}
+
+		for (uint32_t index : data.Tested)
+		{
+			if (m_extractedObjects[index].IsOccluder)
+			{
+				rasterizeOccluder(index);
+				data.Occluders.push_back(index);
+			}
+			else
+			{
+				data.OcclusionCandidates.push_back(index);
+			}
+		}
+		data.Occlusion.FinishOccluders();
+
+		// 가리개 자신은 항상 그리고, 그 뒤에 가려지지 않은 오브젝트를 붙입니다.
+		data.Occlusion.FilterVisible(m_worldAabbs.GetStreams(), data.OcclusionCandidates, data.Tested, m_jobSystem.get());
+		data.Tested.insert(data.Tested.begin(), data.Occluders.begin(), data.Occluders.end());
+	}
+
+	// 2-2. 검사 결과를 캐시에 기록합니다.
+	//      전체 재검사였다면 공간 인덱스에서 걸러진 오브젝트도 '안 보임'으로 기록해야 다음 프레임에 재사용됩니다.
+	data.TestedMask.assign(m_extractedObjects.size(), 0);
+	for (uint32_t index : data.Tested)
+	{
+		data.TestedMask[index] = 1;
+	}
+
+	if (reuseVisibility)
+	{
+		for (uint32_t index : data.Candidates)
+		{
+			const ExtractedObject& extracted = m_extractedObjects[index];
+			data.Visibility.Store(extracted.Object, extracted.TransformVersion, data.TestedMask[index] != 0);
+		}
+	}
+	else
+	{
+		for (uint32_t index = 0; index < m_extractedObjects.size(); ++index)
+		{
+			const ExtractedObject& extracted = m_extractedObjects[index];
+			data.Visibility.Store(extracted.Object, extracted.TransformVersion, data.TestedMask[index] != 0);
+		}
+	}
+	data.Visibility.EndFrame();
+
+	data.Visible.insert(data.Visible.end(), data.Tested.begin(), data.Tested.end());
+
+	// 3. WVP 계산 + LOD 선택
+	//    WVP: 보이는 오브젝트의 TRS를 SoA로 모아 TransformBatch가 4개씩 SIMD로 (S * R * T * ViewProj)^T를 계산합니다.
+	//         (Transform 캐시와 같은 식이므로 추출한 월드 행렬과 같은 결과)
+	//    LOD: 화면 공간 오차가 임계값 이하인 가장 거친 단계 (뷰마다 지난 선택을 기억해 팝핑 방지)
+	data.VisibleTransforms.Resize(data.Visible.size());
+	for (size_t i = 0; i < data.Visible.size(); ++i)
+	{
+		const ExtractedObject& extracted = m_extractedObjects[data.Visible[i]];
+		data.VisibleTransforms.Set(i, extracted.Position, extracted.Rotation, extracted.Scale);
+	}
+
+	data.VisibleWvp.resize(data.Visible.size());
+	TransformBatch::ComputeWorldMatrices(data.VisibleTransforms.GetStreams(), nullptr, &viewData.ViewProjection, data.VisibleWvp.data());
+
+	// 오브젝트가 파괴됐으면 같은 주소에 새 오브젝트가 생길 수 있으므로 기억한 LOD를 모두 버립니다.
+	const uint32_t destroyGeneration = m_activeScene->GetDestroyGeneration();
+	if (data.LodHistoryDestroyGeneration != destroyGeneration)
+	{
+		data.LodHistory.clear();
+		data.LodHistoryDestroyGeneration = destroyGeneration;
+	}
+	++data.LodHistoryFrame;
+
+	const float projectionScaleY = viewData.Projection._22;
+	const float lodThreshold = LOD_PIXEL_ERROR / (std::max)(view.ViewportHeight, 1.0f);
+	const XMVECTOR cameraPosition = XMLoadFloat4A(&viewData.Position);
+
+	data.DrawList.resize(data.Visible.size());
+	for (size_t i = 0; i < data.Visible.size(); ++i)
+	{
+		const uint32_t index = data.Visible[i];
+		const ExtractedObject& extracted = m_extractedObjects[index];
+
+		const XMVECTOR center = XMVectorSet(allSpheres.CenterX[index], allSpheres.CenterY[index], allSpheres.CenterZ[index], 1.0f);
+		const float centerDistance = XMVectorGetX(XMVector3Length(XMVectorSubtract(center, cameraPosition)));
+
+		LodHistoryEntry& history = data.LodHistory[extracted.Object];
+		history.Lod = MeshLod::SelectLod(m_lodLevels, centerDistance - allSpheres.Radius[index], extracted.WorldScale,
+			projectionScaleY, lodThreshold, history.Lod);
+		history.Frame = data.LodHistoryFrame;
+
+		DrawItem& item = data.DrawList[i];
+		item.Lod = history.Lod;
+		item.Depth = centerDistance;
+		item.WorldViewProjection = data.VisibleWvp[i];
+	}
+
+	// 이번 프레임에 보이지 않은 오브젝트는 다시 나타날 때 새로 고르도록 지웁니다. (모두 보였으면 훑을 필요 없음)
+	if (data.LodHistory.size() != data.Visible.size())
+	{
+		for (auto it = data.LodHistory.begin(); it != data.LodHistory.end();)
+		{
+			if (it->second.Frame != data.LodHistoryFrame) it = data.LodHistory.erase(it);
+			else ++it;
+		}
+	}
+
+	// 4. 렌더 큐로 정렬하고 같은 상태끼리 묶어 인스턴스 드로우로 만듭니다.
+	BuildInstanceBatches(data.DrawList, data.Instanced);
+}
+
+// 드로우 리스트를 정렬 키로 정렬한 뒤, 상태(파이프라인/머티리얼/메쉬)가 같은 연속 구간을 한 묶음으로 만듭니다.
+// 불투명은 같은 묶음 안에서 앞에서 뒤로 놓이므로 인스턴스 순서도 앞에서 뒤입니다.
+void MyGame::BuildInstanceBatches(const std::vector<DrawItem>& drawList, InstancedDrawList& out) const
+{
+	out.Queue.Clear();
+	out.Queue.Reserve(drawList.size());
+	for (uint32_t i = 0; i < drawList.size(); ++i)
+	{
+		const DrawItem& item = drawList[i];
+		out.Queue.Push(RenderSortKey::MakeOpaque(SCENE_LAYER, OPAQUE_PASS, DEFAULT_PIPELINE_ID, DEFAULT_MATERIAL_ID, item.Lod, item.Depth), i);
+	}
+	out.Queue.Sort();
+
+	out.Batches.clear();
+	out.Instances.resize(drawList.size());
+
+	const std::vector<RenderPacket>& packets = out.Queue.GetPackets();
+	for (uint32_t i = 0; i < packets.size(); ++i)
+	{
+		const RenderPacket& packet = packets[i];
+		const uint64_t stateBits = RenderSortKey::GetStateBits(packet.Key);
+
+		if (out.Batches.empty() || out.Batches.back().StateBits != stateBits)
+		{
+			out.Batches.push_back({ stateBits, RenderSortKey::GetMesh(packet.Key), i, 0 });
+		}
+		++out.Batches.back().InstanceCount;
+
+		out.Instances[i] = drawList[packet.Index].WorldViewProjection;
+	}
+}
+
+const VisibilityCache::Stats* MyGame::GetVisibilityStats(const Camera& camera) const
+{
+	auto it = m_viewRenderData.find(&camera);
+	return (it != m_viewRenderData.end()) ? &it->second.Visibility.GetTotalStats() : nullptr;
+}
+
+// 묶음 수에 비례해 청크를 나누되, 스레드 수보다 많이 나누지는 않습니다.
+size_t MyGame::GetRender3DSceneChunkCount(const Camera& camera) const
+{
+	auto it = m_viewRenderData.find(&camera);
+	if (it == m_viewRenderData.end()) return 1;
+
+	const size_t chunkCount = JobSystem::GetChunkCount(it->second.Instanced.Batches.size(), MIN_BATCHES_PER_RECORD_CHUNK);
+	return (std::min)((std::max)(chunkCount, size_t(1)), static_cast<size_t>(m_jobSystem->GetThreadCount()));
+}
+
+// '그리기' 명령. D3D12App::Render() 내부에서 워커 스레드들이 청크별로 동시에 호출합니다.
+// 엔진이 RTV/DSV 설정, 뷰포트/시저 설정을 '끝낸 후' 호출됩니다.
+// 컬링과 행렬 계산은 PrepareViews에서 끝났으므로, 여기서는 이 뷰의 묶음 중 자기 몫만 기록합니다.
+void MyGame::Render3DScene(const Camera& camera, RHICommandList& commandList, size_t chunkIndex, size_t chunkCount)
+{
+	auto it = m_viewRenderData.find(&camera);
+	if (it == m_viewRenderData.end()) return;
+
+	const InstancedDrawList& drawList = it->second.Instanced;
+	const size_t batchCount = drawList.Batches.size();
+	RecordDrawList(commandList, drawList, batchCount * chunkIndex / chunkCount, batchCount * (chunkIndex + 1) / chunkCount);
+}
+
+// 뷰의 인스턴스 WVP(이미 전치된 상태)를 한 번에 링 버퍼로 복사하고 GPU 주소를 기억합니다.
+void MyGame::UploadInstances(UploadRingBuffer& uploadRing, InstancedDrawList& drawList)
+{
+	drawList.InstanceAddress = 0;
+	if (drawList.Instances.empty()) return;
+
+	const size_t instanceBytes = drawList.Instances.size() * sizeof(XMFLOAT4X4);
+	const UploadRingBuffer::Allocation allocation = uploadRing.Allocate(instanceBytes, 16);
+	memcpy(allocation.CPUAddress, drawList.Instances.data(), instanceBytes);
+	drawList.InstanceAddress = allocation.GPUAddress;
+}
+
+// 드로우 리스트의 묶음 [batchBegin, batchEnd)를 RHI 커맨드 리스트에 기록합니다. (UploadInstances 이후)
+// (NullRHI 커맨드 리스트를 넘기면 GPU 없이 제출 비용과 드로우 수를 잴 수 있습니다)
+void MyGame::RecordDrawList(RHICommandList& commandList, const InstancedDrawList& drawList, size_t batchBegin, size_t batchEnd) const
+{
+	if (batchBegin >= batchEnd || drawList.InstanceAddress == 0) return;
+
+	const uint64_t instanceStride = sizeof(XMFLOAT4X4);
+
+	// 묶음은 정렬 키 순서이므로 같은 상태가 연속으로 나옵니다. 직전과 같은 설정은 캐시가 걸러냅니다.
+	RenderStateCache stateCache(commandList);
+
+	for (size_t i = batchBegin; i < batchEnd; ++i)
+	{
+		const InstanceBatch& batch = drawList.Batches[i];
+
+		// [게임] PSO, RootSig 설정 (파이프라인 ID는 아직 DEFAULT_PIPELINE_ID 하나뿐)
+		stateCache.SetPipeline(m_pipeline);
+
+		// [게임] 리소스 바인딩 (ECS RenderSystem이 이 작업을 할 것입니다)
+		stateCache.SetVertexBuffer(m_vertexBuffer.get(), sizeof(Vertex)); // 정점 버퍼 설정
+		stateCache.SetIndexBuffer(m_indexBuffer.get(), RHIFormat::R32_UInt); // 인덱스 버퍼 설정
+		stateCache.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
 
-		// WVP  մϴ.
-		XMMATRIX wvp = worldMatrix * viewMatrix * projMatrix;
-		wvp = XMMatrixTranspose(wvp); //  ġմϴ.
+		// SV_InstanceID는 StartInstanceLocation과 상관없이 0부터 시작하므로,
+		// 묶음마다 t0을 자기 구간의 시작 주소로 옮겨서 바인딩합니다.
+		commandList.SetShaderResource(0, drawList.InstanceAddress + batch.FirstInstance * instanceStride);
 
-		//  ۿ WVP  մϴ.
-		memcpy(m_pCbvDataBegin, &wvp, sizeof(XMMATRIX));
-		m_commandList->SetGraphicsRootConstantBufferView(0, m_constantBuffer->GetGPUVirtualAddress());
-	
-		// [] ׸
-		m_commandList->DrawIndexedInstanced(
-			static_cast<UINT>(m_indices.size()),
-			1, 0, 0, 0
-		);
+		// [게임] 그리기 (선택된 LOD의 인덱스 구간을 묶음의 인스턴스 수만큼)
+		const LodLevel& lod = m_lodLevels[batch.Lod];
+		commandList.DrawIndexed(lod.IndexCount, batch.InstanceCount, lod.IndexStart, 0, 0);
 	}
 }
 
-//     ȣ˴ϴ.
-//   ҽ(: G-Buffer)   ϴ.
+// 엔진이 리사이즈를 끝낸 후 호출됩니다.
+// 게임이 소유한 리소스(예: G-Buffer)를 리사이즈할 때 씁니다.
 void MyGame::OnResize(UINT width, UINT height)
 {
 	Debug::Print(L"MyGame OnResize: " + std::to_wstring(width) + L"x" + std::to_wstring(height));
-	// (     ҽ Ƿ Ӵϴ.)
+	// (현재는 게임이 소유한 리사이즈 대상 리소스가 없으므로 비워둡니다.)
 }
 
-void MyGame::Shutdown()
+// D3D12App::Shutdown()이 GPU를 비운 뒤 호출합니다. 힙에 배치된 버퍼는 여기서 해제해도 안전합니다.
+void MyGame::OnShutdown()
 {
+	m_viewRenderData.clear();
+	m_preparedViews.clear();
+	m_extractedObjects.clear();
+	m_extractedIndexOf.clear();
+	m_gameCamera = nullptr; // m_activeScene 소유
+	m_activeScene.reset();
+
+	m_vertexBuffer.reset();
+	m_indexBuffer.reset();
+	m_pipeline = nullptr;
 }
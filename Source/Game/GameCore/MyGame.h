@@ -1,23 +1,30 @@
 #pragma once
 
-// Engine Ʈ D3D12App.h include մϴ.
+// Engine 프로젝트의 D3D12App.h를 include 합니다.
 #include "Core/D3D12App.h" 
 
-//   '' ƴ '' include ˴ϴ.
+// 게임 로직은 '엔진'이 아닌 '게임'에만 include 됩니다.
 #include "Managers/ModelManager.h"
-//#include "ECS/Registry.h" // (ECS  )
+#include "Math/TransformBatch.h"
+#include "Rendering/FrustumCulling.h"
+#include "Rendering/OcclusionCuller.h"
+#include "Rendering/RenderQueue.h"
+#include "Rendering/VisibilityCache.h"
+#include "Spatial/MeshBVH.h"
+//#include "ECS/Registry.h" // (ECS 사용 예시)
 
 
 #include <memory>
 #include <vector>
+#include <unordered_map>
 
 class Scene;
 class GameObject;
 class Camera;
 
 /*
- * MyGame D3D12App ӿũ ''ϴ ü(Concrete) ŬԴϴ.
- *  Ŭ '츮 ' ʿ ҽ(PSO, ޽) մϴ.
+ * MyGame은 D3D12App 프레임워크를 '구현'하는 구체적인(Concrete) 클래스입니다.
+ * 이 클래스가 '우리 게임'에 필요한 리소스(PSO, 메쉬)를 소유합니다.
 */
 
 class MyGame : public D3D12App
@@ -28,38 +35,126 @@ public:
 
 	virtual bool Init(HWND hWnd, UINT width, UINT height) override;
 	virtual void Update(float dt) override;
-	virtual void Shutdown() override;
+
+	// 뷰(카메라)별 가시성 캐시 통계. 아직 준비된 적 없는 카메라면 nullptr
+	const VisibilityCache::Stats* GetVisibilityStats(const Camera& camera) const;
 
 protected:
-	virtual void Render3DScene(const Camera& camera) override;
+	virtual void PrepareViews(const RenderView* views, size_t viewCount) override;
+	virtual void Render3DScene(const Camera& camera, RHICommandList& commandList, size_t chunkIndex, size_t chunkCount) override;
+	virtual size_t GetRender3DSceneChunkCount(const Camera& camera) const override;
 	virtual void OnResize(UINT width, UINT height) override;
+	virtual void OnShutdown() override;
 
 private:
 
-	// ECS ý ()
+	// ECS 시스템 (예시)
 	//Registry m_registry; 
 	// TransformSystem m_transformSystem;
 	// RenderSystem m_renderSystem;
 
-	// ҽ 
+	// 리소스 관리자
 	ModelManager m_modelManager;
 
-	// Ȱ 
+	// 활성 씬
 	std::unique_ptr<Scene> m_activeScene;
 
-	//  ҽ (PSO, RootSig, Mesh )
-	Microsoft::WRL::ComPtr<ID3D12RootSignature> m_rootSignature;
-	Microsoft::WRL::ComPtr<ID3D12PipelineState> m_pso;
+	// 게임 리소스 (PSO, RootSig, Mesh 등) - RHI로 생성합니다.
+	RHIPipeline* m_pipeline = nullptr; // m_pipelineCache 소유
 
 	std::vector<Vertex> m_vertices;
 	std::vector<UINT> m_indices;
 
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_vertexBuffer;
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_indexBuffer;
-
-	D3D12_VERTEX_BUFFER_VIEW m_vbView;
-	D3D12_INDEX_BUFFER_VIEW m_ibView;
-
-	Microsoft::WRL::ComPtr<ID3D12Resource> m_constantBuffer; //  
-	UINT8* m_pCbvDataBegin = nullptr; //    
+	std::unique_ptr<RHIBuffer> m_vertexBuffer;
+	std::unique_ptr<RHIBuffer> m_indexBuffer;
+
+	// 임포트 시 계산된 서브메쉬 범위와 메쉬 전체의 로컬 바운딩 볼륨
+	std::vector<SubMesh> m_subMeshes;
+	MeshBounds m_meshBounds;
+	std::vector<LodLevel> m_lodLevels; // LOD 0 = 원본, 인덱스 구간은 m_indices 안
+	MeshBVH m_meshBVH;                 // LOD 0 삼각형, Scene 레이 질의용
+
+	// [프레임 추출] 뷰와 무관한 데이터. PrepareViews에서 프레임당 한 번만 계산합니다.
+	struct ExtractedObject
+	{
+		GameObject* Object = nullptr;
+		DirectX::XMFLOAT4X4 World;  // Transform 캐시에서 복사
+		DirectX::XMFLOAT3 Position; // WVP 일괄 계산(TransformBatch) 입력
+		DirectX::XMFLOAT4 Rotation;
+		DirectX::XMFLOAT3 Scale;
+		float WorldScale = 1.0f;    // 로컬 -> 월드 오차 변환용 (최대 축 스케일)
+		uint32_t TransformVersion = 0; // 가시성 캐시 재사용 판단용
+		bool IsOccluder = false;
+	};
+
+	struct DrawItem
+	{
+		DirectX::XMFLOAT4X4 WorldViewProjection; // 셰이더용으로 전치된 상태
+		uint32_t Lod = 0;
+		float Depth = 0.0f; // 카메라까지의 거리 (정렬 키용)
+	};
+
+	// 같은 파이프라인/메쉬 구간/머티리얼을 쓰는 드로우 묶음. 인스턴스 드로우 한 번으로 그립니다.
+	// (지금은 파이프라인과 머티리얼이 하나뿐이고 LOD마다 인덱스 구간이 다르므로 LOD가 곧 메쉬 ID입니다.)
+	struct InstanceBatch
+	{
+		uint64_t StateBits = 0;     // RenderSortKey::GetStateBits
+		uint32_t Lod = 0;
+		uint32_t FirstInstance = 0; // Instances 안에서의 시작 위치
+		uint32_t InstanceCount = 0;
+	};
+
+	struct InstancedDrawList
+	{
+		std::vector<DirectX::XMFLOAT4X4> Instances; // 묶음 순서로 모은 WVP (SimpleVS의 InstanceData)
+		std::vector<InstanceBatch> Batches;
+		RenderQueue Queue;                          // 만드는 동안 쓰는 정렬 큐 (버퍼 재사용)
+		uint64_t InstanceAddress = 0;               // Instances를 올린 업로드 링의 GPU 주소 (UploadInstances)
+	};
+
+	// 뷰별로 지난번에 고른 LOD (히스테리시스 기준값)
+	struct LodHistoryEntry
+	{
+		uint32_t Lod = UINT32_MAX; // 아직 고른 적 없음
+		uint32_t Frame = 0;        // 마지막으로 고른 프레임 (LodHistoryFrame)
+	};
+
+	// [뷰별 데이터] 뷰마다 독립이므로 워커 스레드에서 동시에 만들 수 있습니다.
+	struct ViewRenderData
+	{
+		VisibilityCache Visibility;              // 지난 프레임 결과 재사용
+		std::vector<uint32_t> Candidates;        // 이번 프레임에 다시 검사할 오브젝트 (추출 인덱스)
+		BoundingSphereBuffer CandidateSpheres;
+		std::vector<uint32_t> Tested;            // Candidates 중 검사를 통과한 오브젝트
+		std::vector<uint8_t> TestedMask;         // 추출 인덱스별 Tested 포함 여부 (캐시 기록용)
+		std::vector<uint32_t> Visible;           // 최종 보이는 오브젝트 (추출 인덱스)
+		std::vector<uint32_t> OcclusionCandidates;
+		std::vector<uint32_t> Occluders;
+		OcclusionCuller Occlusion;
+		// 키는 오브젝트 주소이므로, 이번 프레임에 보이지 않은 항목은 지우고 오브젝트가 파괴되면(풀 슬롯 재사용) 통째로 비웁니다.
+		std::unordered_map<const GameObject*, LodHistoryEntry> LodHistory;
+		uint32_t LodHistoryFrame = 0;
+		uint32_t LodHistoryDestroyGeneration = 0; // Scene::GetDestroyGeneration
+		TransformStreamBuffer VisibleTransforms; // Visible 순서로 모은 TRS (SoA)
+		std::vector<DirectX::XMFLOAT4X4> VisibleWvp; // 위에서 SIMD로 한 번에 계산한 전치 WVP
+		std::vector<DrawItem> DrawList;
+		InstancedDrawList Instanced;             // DrawList를 묶은 것. Render3DScene은 이것만 기록합니다.
+	};
+
+	void ExtractFrame();
+	void BuildViewDrawList(const RenderView& view, ViewRenderData& data) const;
+	void BuildInstanceBatches(const std::vector<DrawItem>& drawList, InstancedDrawList& out) const;
+	static void UploadInstances(UploadRingBuffer& uploadRing, InstancedDrawList& drawList);
+	void RecordDrawList(RHICommandList& commandList, const InstancedDrawList& drawList, size_t batchBegin, size_t batchEnd) const;
+
+	std::vector<ExtractedObject> m_extractedObjects;
+	std::unordered_map<const GameObject*, uint32_t> m_extractedIndexOf;
+	BoundingSphereBuffer m_worldSpheres; // m_extractedObjects와 같은 순서
+	AabbBuffer m_worldAabbs;
+	uint64_t m_visibilityStamp = 0; // 가리개/파괴/오클루전 설정이 바뀌면 달라지는 값 (VisibilityCache::BeginFrame)
+
+	std::unordered_map<const Camera*, ViewRenderData> m_viewRenderData;
+	std::vector<std::pair<RenderView, ViewRenderData*>> m_preparedViews; // PrepareViews 재사용 버퍼
+
+	bool m_occlusionCullingEnabled = true;
 };
\ No newline at end of file
@@ -1,4 +1,4 @@
-// DirectX12EngineProject.cpp : ø̼ǿ   մϴ.
+// DirectX12EngineProject.cpp : 애플리케이션에 대한 진입점을 정의합니다.
 
 #include <Windows.h>
 #include "Utils/Utils.h"
@@ -5,7 +5,8 @@
 
 
 void ModelManager::LoadModel(const std::string& fileName, std::vector<Vertex>& outVertices,
-    std::vector<uint32_t>& outIndices)
+    std::vector<uint32_t>& outIndices, std::vector<SubMesh>& outSubMeshes, MeshBounds& outBounds,
+    std::vector<LodLevel>& outLods)
 {
     std::filesystem::path filePath = GetExeDirectory() / "Assets\\Models" / fileName;
 
@@ -29,38 +30,60 @@ void ModelManager::LoadModel(const std::string& fileName, std::vector<Vertex>& o
 
 	outVertices.clear();
 	outIndices.clear();
+	outSubMeshes.clear();
+	outBounds = {};
+	outLods.clear();
 
     // Now we can access the file's contents.
-	ProcessNode(scene->mRootNode, scene, outVertices, outIndices);
+	ProcessNode(scene->mRootNode, scene, outVertices, outIndices, outSubMeshes);
+
+	// 메쉬 전체 바운딩 볼륨 = 서브메쉬 바운딩 볼륨의 합
+	for (size_t i = 0; i < outSubMeshes.size(); ++i)
+	{
+		outBounds = (i == 0) ? outSubMeshes[i].Bounds : Bounds::Merge(outBounds, outSubMeshes[i].Bounds);
+	}
+
+	// 거친 LOD 단계를 만들어 인덱스 버퍼 뒤에 붙입니다. (서브메쉬 범위는 LOD 0 기준 그대로)
+	if (!outVertices.empty())
+	{
+		MeshLod::BuildLodChain(&outVertices[0].Position, sizeof(Vertex), outVertices.size(),
+			outIndices, outIndices.size(), outBounds.Box, outLods);
+	}
 
     // We're done. Everything will be cleaned up by the importer destructor
     return;
 }
 
-// 带  鼭  mesh ó
+// 노드를 재귀적으로 돌면서 모든 mesh 처리
 void ModelManager::ProcessNode(aiNode* node, const aiScene* scene,
     std::vector<Vertex>& vertices,
-    std::vector<uint32_t>& indices)
+    std::vector<uint32_t>& indices,
+    std::vector<SubMesh>& subMeshes)
 {
-    //  忡   mesh ó
+    // 이 노드에 속한 모든 mesh 처리
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
     {
         aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        ProcessMesh(mesh, vertices, indices);
+        ProcessMesh(mesh, vertices, indices, subMeshes);
     }
 
-    // ڽ  
+    // 자식 노드 재귀
     for (unsigned int i = 0; i < node->mNumChildren; i++)
     {
-        ProcessNode(node->mChildren[i], scene, vertices, indices);
+        ProcessNode(node->mChildren[i], scene, vertices, indices, subMeshes);
     }
 }
 
-// mesh ϳ о vertices/indices push_back
+// mesh 하나를 읽어서 vertices/indices에 push_back하고, 서브메쉬(범위 + 바운딩 볼륨)를 기록
 void ModelManager::ProcessMesh(aiMesh* mesh,
     std::vector<Vertex>& vertices,
-    std::vector<uint32_t>& indices)
+    std::vector<uint32_t>& indices,
+    std::vector<SubMesh>& subMeshes)
 {
+    SubMesh subMesh;
+    subMesh.VertexStart = static_cast<uint32_t>(vertices.size());
+    subMesh.IndexStart = static_cast<uint32_t>(indices.size());
+
     for (unsigned int i = 0; i < mesh->mNumVertices; i++)
     {
         Vertex v{};
@@ -81,7 +104,14 @@ void ModelManager::ProcessMesh(aiMesh* mesh,
         const aiFace& face = mesh->mFaces[i];
         for (unsigned int j = 0; j < face.mNumIndices; j++)
         {
-            indices.push_back(face.mIndices[j]);
+            // aiMesh의 인덱스는 자기 정점 기준이므로, 하나의 정점 버퍼에 합칠 때 시작 위치만큼 밀어줍니다.
+            indices.push_back(subMesh.VertexStart + face.mIndices[j]);
         }
     }
+
+    subMesh.VertexCount = static_cast<uint32_t>(vertices.size()) - subMesh.VertexStart;
+    subMesh.IndexCount = static_cast<uint32_t>(indices.size()) - subMesh.IndexStart;
+    subMesh.Bounds = Bounds::Compute(&(vertices.data() + subMesh.VertexStart)->Position, subMesh.VertexCount, sizeof(Vertex));
+
+    subMeshes.push_back(subMesh);
 }
\ No newline at end of file
@@ -7,6 +7,10 @@
 
 #include <DirectXMath.h>
 
+#include "Math/Bounds.h"
+#include "Rendering/MeshLod.h"
+#include "Utils/StringId.h"
+
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -20,20 +24,35 @@ struct Vertex
 	DirectX::XMFLOAT3 Bitangent;
 };
 
+// 하나의 aiMesh에 해당하는 인덱스 범위와 바운딩 볼륨
+struct SubMesh
+{
+	uint32_t IndexStart = 0;
+	uint32_t IndexCount = 0;
+	uint32_t VertexStart = 0;
+	uint32_t VertexCount = 0;
+	MeshBounds Bounds;
+};
+
 class ModelManager
 {
 public:
 
-	std::unordered_map<std::string, uint32_t> loadedModels; // key: fileName, value: meshID
+	std::unordered_map<StringId, uint32_t> loadedModels; // key: fileName, value: meshID
 	
 	ModelManager() = default;
 	~ModelManager() = default;
 
+	// outSubMeshes: aiMesh마다 하나씩, outBounds: 모든 서브메쉬를 감싸는 메쉬 전체 바운딩 볼륨
+	// outLods: 메쉬 전체의 LOD 체인 (LOD 0 = 원본, 거친 단계의 인덱스는 outIndices 뒤에 붙음)
 	static void LoadModel(const std::string& fileName, std::vector<Vertex>& outVertices,
-		std::vector<uint32_t>& outIndices);
+		std::vector<uint32_t>& outIndices, std::vector<SubMesh>& outSubMeshes, MeshBounds& outBounds,
+		std::vector<LodLevel>& outLods);
 
 private:
-	static void ProcessMesh(aiMesh* mesh, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
-	static void ProcessNode(aiNode* node, const aiScene* scene, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+	static void ProcessMesh(aiMesh* mesh, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+		std::vector<SubMesh>& subMeshes);
+	static void ProcessNode(aiNode* node, const aiScene* scene, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+		std::vector<SubMesh>& subMeshes);
 };
 
@@ -10,24 +10,28 @@ struct VSInput
 };
 
 
-cbuffer SceneConstants : register(b0)
+// 인스턴스별 데이터 (MyGame::InstanceData와 같은 배치)
+// 같은 메쉬 구간을 쓰는 오브젝트들을 한 번의 인스턴스 드로우로 그리고, SV_InstanceID로 자기 행렬을 찾습니다.
+struct InstanceData
 {
-    float4x4 gWorldViewProj;
+    float4x4 WorldViewProj;
 };
 
+StructuredBuffer<InstanceData> gInstances : register(t0);
+
 struct PSInput
 {
-    float4 position : SV_Position; // Ŭ  ǥ
-    float3 normal : NORMAL; //  normal
-    float2 texcoord : TEXCOORD; //  uv
+    float4 position : SV_Position; // 클립 공간 좌표
+    float3 normal : NORMAL; // 보간용 normal
+    float2 texcoord : TEXCOORD; // 보간용 uv
 };
 
-PSInput VSMain(VSInput input)
+PSInput VSMain(VSInput input, uint instanceID : SV_InstanceID)
 {
     PSInput result;
-    result.position = mul(float4(input.position, 1.0f), gWorldViewProj);
+    result.position = mul(float4(input.position, 1.0f), gInstances[instanceID].WorldViewProj);
 
-    // ⼭ ׳ normal ÷ó ѱ ()
+    // 여기서는 그냥 normal을 컬러처럼 넘김 (디버깅용)
     result.normal = normalize(input.normal);
     result.texcoord = input.texcoord;
 
@@ -0,0 +1,179 @@
+// PipelineKeyTests.cpp
+// RHIPipelineKey가 내용으로 같은 설명을 같은 키로, 결과가 다른 설명을 다른 키로 만드는지와
+// PipelineCache가 그 키로 중복 생성을 막는지 검사합니다.
+#include "TestFramework.h"
+
+#include "RHI/NullRHI.h"
+#include "RHI/PipelineCache.h"
+
+#include <string>
+
+namespace
+{
+	// 진짜 바이트코드일 필요는 없고, 내용이 같은지 다른지만 중요합니다.
+	struct TestShaders
+	{
+		std::vector<uint8_t> Vertex = std::vector<uint8_t>(128, 0xAB);
+		std::vector<uint8_t> Pixel = std::vector<uint8_t>(64, 0xCD);
+	};
+
+	const RHIInputElement TEST_INPUT_LAYOUT[] =
+	{
+		{ "POSITION", 0, RHIFormat::R32G32B32_Float, 0, 0 },
+		{ "TEXCOORD", 0, RHIFormat::R32G32_Float, 0, 12 },
+	};
+
+	RHIGraphicsPipelineDesc MakeDesc(const TestShaders& shaders)
+	{
+		RHIGraphicsPipelineDesc desc;
+		desc.VertexShader = { shaders.Vertex.data(), shaders.Vertex.size() };
+		desc.PixelShader = { shaders.Pixel.data(), shaders.Pixel.size() };
+		desc.InputLayout = TEST_INPUT_LAYOUT;
+		desc.InputElementCount = 2;
+		return desc;
+	}
+
+	bool SameKey(const RHIGraphicsPipelineDesc& a, const RHIGraphicsPipelineDesc& b)
+	{
+		const RHIPipelineKey keyA = RHIPipelineKey::Create(a);
+		const RHIPipelineKey keyB = RHIPipelineKey::Create(b);
+		return keyA == keyB && keyA.Hash == keyB.Hash;
+	}
+}
+
+// 같은 설명은 같은 키, 같은 해시
+ENGINE_TEST(PipelineKeyEqualForSameDesc)
+{
+	const TestShaders shaders;
+	const RHIGraphicsPipelineDesc desc = MakeDesc(shaders);
+
+	const RHIPipelineKey first = RHIPipelineKey::Create(desc);
+	const RHIPipelineKey second = RHIPipelineKey::Create(desc);
+	CHECK(first == second);
+	CHECK(!(first != second));
+	CHECK_EQ(first.Hash, second.Hash);
+	CHECK(!first.Bytes.empty());
+}
+
+// 포인터가 아니라 내용으로 비교하므로, 셰이더와 시맨틱 문자열을 다시 읽어 와도 같은 키여야 합니다.
+ENGINE_TEST(PipelineKeyIgnoresPointers)
+{
+	const TestShaders shaders;
+	const TestShaders reloaded;
+	const std::string position = "POSITION";
+	const std::string texcoord = "TEXCOORD";
+	const RHIInputElement copiedLayout[] =
+	{
+		{ position.c_str(), 0, RHIFormat::R32G32B32_Float, 0, 0 },
+		{ texcoord.c_str(), 0, RHIFormat::R32G32_Float, 0, 12 },
+	};
+
+	RHIGraphicsPipelineDesc copy = MakeDesc(reloaded);
+	copy.InputLayout = copiedLayout;
+	CHECK(shaders.Vertex.data() != reloaded.Vertex.data());
+	CHECK(SameKey(MakeDesc(shaders), copy));
+}
+
+// D3D12 파이프라인에는 토폴로지 종류만 들어가므로 리스트/스트립은 같은 키, 선/점은 다른 키입니다.
+ENGINE_TEST(PipelineKeyTopologyClass)
+{
+	const TestShaders shaders;
+	const RHIGraphicsPipelineDesc list = MakeDesc(shaders);
+
+	RHIGraphicsPipelineDesc strip = list;
+	strip.Topology = RHIPrimitiveTopology::TriangleStrip;
+	CHECK(SameKey(list, strip));
+
+	RHIGraphicsPipelineDesc lines = list;
+	lines.Topology = RHIPrimitiveTopology::LineList;
+	CHECK(!SameKey(list, lines));
+
+	RHIGraphicsPipelineDesc points = list;
+	points.Topology = RHIPrimitiveTopology::PointList;
+	CHECK(!SameKey(lines, points));
+}
+
+// 결과 파이프라인이 달라지는 값은 하나만 바뀌어도 다른 키여야 합니다.
+ENGINE_TEST(PipelineKeyDiffersOnState)
+{
+	const TestShaders shaders;
+	const RHIGraphicsPipelineDesc base = MakeDesc(shaders);
+
+	RHIGraphicsPipelineDesc cull = base;
+	cull.CullMode = RHICullMode::None;
+	CHECK(!SameKey(base, cull));
+
+	RHIGraphicsPipelineDesc renderTarget = base;
+	renderTarget.RenderTargetFormat = RHIFormat::R8G8B8A8_UNorm_sRGB;
+	CHECK(!SameKey(base, renderTarget));
+
+	RHIGraphicsPipelineDesc depthFormat = base;
+	depthFormat.DepthStencilFormat = RHIFormat::Unknown;
+	CHECK(!SameKey(base, depthFormat));
+
+	RHIGraphicsPipelineDesc depthWrite = base;
+	depthWrite.DepthWrite = false;
+	CHECK(!SameKey(base, depthWrite));
+
+	RHIGraphicsPipelineDesc rootLayout = base;
+	rootLayout.ConstantBufferCount = 0;
+	rootLayout.ShaderResourceCount = 1;
+	CHECK(!SameKey(base, rootLayout));
+
+	RHIGraphicsPipelineDesc inputLayout = base;
+	inputLayout.InputElementCount = 1;
+	CHECK(!SameKey(base, inputLayout));
+}
+
+// 셰이더는 크기가 같아도 내용이 바뀌면 다른 키여야 합니다. (디스크 라이브러리에서 옛 파이프라인을 꺼내지 않도록)
+ENGINE_TEST(PipelineKeyDiffersOnShaderBytes)
+{
+	const TestShaders shaders;
+	TestShaders edited;
+	edited.Pixel[edited.Pixel.size() / 2] ^= 0x01;
+
+	CHECK(!SameKey(MakeDesc(shaders), MakeDesc(edited)));
+
+	TestShaders longer;
+	longer.Vertex.push_back(0xAB);
+	CHECK(!SameKey(MakeDesc(shaders), MakeDesc(longer)));
+}
+
+// 디스크 라이브러리 이름은 "PSO_" + 해시 16자리 16진수(대문자)입니다.
+ENGINE_TEST(PipelineKeyName)
+{
+	RHIPipelineKey key;
+	key.Hash = 0x0123456789ABCDEFull;
+	CHECK(key.ToName() == L"PSO_0123456789ABCDEF");
+
+	key.Hash = 0xF;
+	CHECK(key.ToName() == L"PSO_000000000000000F");
+}
+
+// 같은 내용의 설명은 한 번만 만들고 같은 포인터를 돌려줘야 합니다.
+ENGINE_TEST(PipelineCacheDeduplicates)
+{
+	NullRHIDevice device;
+	PipelineCache cache(device);
+
+	const TestShaders shaders;
+	const TestShaders reloaded;
+	const RHIGraphicsPipelineDesc desc = MakeDesc(shaders);
+
+	RHIPipeline* first = cache.GetOrCreate(desc);
+	CHECK(first != nullptr);
+
+	RHIGraphicsPipelineDesc strip = MakeDesc(reloaded);
+	strip.Topology = RHIPrimitiveTopology::TriangleStrip;
+	CHECK(cache.GetOrCreate(strip) == first);
+
+	RHIGraphicsPipelineDesc noCull = desc;
+	noCull.CullMode = RHICullMode::None;
+	RHIPipeline* second = cache.GetOrCreate(noCull);
+	CHECK(second != nullptr);
+	CHECK(second != first);
+
+	CHECK_EQ(cache.GetCount(), size_t(2));
+	CHECK_EQ(cache.GetHitCount(), 1u);
+	CHECK_EQ(cache.GetMissCount(), 2u);
+}
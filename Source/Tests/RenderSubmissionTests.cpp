@@ -0,0 +1,269 @@
+// RenderSubmissionTests.cpp
+// 렌더 큐 정렬 -> 인스턴스 묶음 -> RenderStateCache로 NullRHI 커맨드 리스트에 기록하는 경로를 검사합니다.
+// (MyGame::BuildInstanceBatches / RecordDrawList와 같은 순서로 기록)
+#include "TestFramework.h"
+
+#include "RHI/NullRHI.h"
+#include "Rendering/RenderQueue.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	constexpr uint32_t PIPELINE_COUNT = 2;
+	constexpr uint32_t MATERIAL_COUNT = 3;
+	constexpr uint32_t MESH_COUNT = 4;
+	constexpr uint32_t MESH_INDEX_COUNT = 36; // 메쉬 하나 = 삼각형 12개
+	constexpr uint64_t INSTANCE_STRIDE = 64;  // float4x4
+
+	struct TestDrawItem
+	{
+		uint32_t Pipeline = 0;
+		uint32_t Material = 0;
+		uint32_t Mesh = 0;
+		float Depth = 0.0f;
+		bool Translucent = false;
+	};
+
+	struct TestBatch
+	{
+		uint64_t StateBits = 0;
+		uint32_t Pipeline = 0;
+		uint32_t Mesh = 0;
+		uint32_t FirstInstance = 0; // 정렬된 패킷 안에서의 시작 위치
+		uint32_t InstanceCount = 0;
+	};
+
+	// 상태 조합을 골고루 섞고, 깊이는 정렬 순서와 무관하게 흩어 둡니다.
+	std::vector<TestDrawItem> MakeOpaqueItems(uint32_t count)
+	{
+		std::vector<TestDrawItem> items(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			TestDrawItem& item = items[i];
+			item.Pipeline = i % PIPELINE_COUNT;
+			item.Material = (i / PIPELINE_COUNT) % MATERIAL_COUNT;
+			item.Mesh = (i / (PIPELINE_COUNT * MATERIAL_COUNT)) % MESH_COUNT;
+			item.Depth = static_cast<float>((i * 7919u) % 1000u) * 0.1f;
+		}
+		return items;
+	}
+
+	void BuildBatches(const std::vector<TestDrawItem>& items, RenderQueue& queue, std::vector<TestBatch>& outBatches)
+	{
+		queue.Clear();
+		queue.Reserve(items.size());
+		for (uint32_t i = 0; i < items.size(); ++i)
+		{
+			const TestDrawItem& item = items[i];
+			const uint64_t key = item.Translucent
+				? RenderSortKey::MakeTranslucent(0, 0, item.Pipeline, item.Material, item.Mesh, item.Depth)
+				: RenderSortKey::MakeOpaque(0, 0, item.Pipeline, item.Material, item.Mesh, item.Depth);
+			queue.Push(key, i);
+		}
+		queue.Sort();
+
+		outBatches.clear();
+		const std::vector<RenderPacket>& packets = queue.GetPackets();
+		for (uint32_t i = 0; i < packets.size(); ++i)
+		{
+			const uint64_t stateBits = RenderSortKey::GetStateBits(packets[i].Key);
+			if (outBatches.empty() || outBatches.back().StateBits != stateBits)
+			{
+				outBatches.push_back({ stateBits, RenderSortKey::GetPipeline(packets[i].Key), RenderSortKey::GetMesh(packets[i].Key), i, 0 });
+			}
+			++outBatches.back().InstanceCount;
+		}
+	}
+
+	struct SubmissionFixture
+	{
+		NullRHIDevice Device;
+		std::unique_ptr<RHIPipeline> Pipelines[PIPELINE_COUNT];
+		std::unique_ptr<RHIBuffer> VertexBuffer;
+		std::unique_ptr<RHIBuffer> IndexBuffer;
+		std::unique_ptr<RHIBuffer> InstanceBuffer;
+		std::unique_ptr<RHICommandList> CommandList;
+
+		explicit SubmissionFixture(uint64_t instanceCount)
+		{
+			RHIGraphicsPipelineDesc pipelineDesc;
+			pipelineDesc.ShaderResourceCount = 1;
+			for (std::unique_ptr<RHIPipeline>& pipeline : Pipelines)
+			{
+				pipeline = Device.CreateGraphicsPipeline(pipelineDesc);
+			}
+
+			VertexBuffer = Device.CreateBuffer({ 1024, RHIHeapType::Default, RHIResourceState::Common });
+			IndexBuffer = Device.CreateBuffer({ MESH_COUNT * MESH_INDEX_COUNT * sizeof(uint32_t), RHIHeapType::Default, RHIResourceState::Common });
+			InstanceBuffer = Device.CreateBuffer({ (instanceCount > 0 ? instanceCount : 1) * INSTANCE_STRIDE, RHIHeapType::Upload, RHIResourceState::GenericRead });
+			CommandList = Device.CreateCommandList(RHIQueueType::Direct);
+		}
+
+		NullRHICommandList& GetNullCommandList() { return static_cast<NullRHICommandList&>(*CommandList); }
+
+		// 반환값: 이 기록에서 걸러진 상태 설정 수
+		uint32_t Record(const std::vector<TestBatch>& batches, uint32_t* outIssued = nullptr)
+		{
+			RenderStateCache stateCache(*CommandList);
+			const uint64_t instanceAddress = InstanceBuffer->GetGPUAddress();
+
+			for (const TestBatch& batch : batches)
+			{
+				stateCache.SetPipeline(Pipelines[batch.Pipeline].get());
+				stateCache.SetVertexBuffer(VertexBuffer.get(), 56);
+				stateCache.SetIndexBuffer(IndexBuffer.get(), RHIFormat::R32_UInt);
+				stateCache.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+
+				CommandList->SetShaderResource(0, instanceAddress + batch.FirstInstance * INSTANCE_STRIDE);
+				CommandList->DrawIndexed(MESH_INDEX_COUNT, batch.InstanceCount, batch.Mesh * MESH_INDEX_COUNT, 0, 0);
+			}
+
+			if (outIssued) *outIssued = stateCache.GetIssuedCount();
+			return stateCache.GetElidedCount();
+		}
+	};
+}
+
+// 불투명 드로우는 (파이프라인, 머티리얼, 메쉬) 조합마다 정확히 한 번 그려지고,
+// 파이프라인은 정렬 키의 최상위 상태이므로 파이프라인 수만큼만 바뀌어야 합니다.
+ENGINE_TEST(SubmissionDrawAndStateCounts)
+{
+	constexpr uint32_t itemCount = 10000;
+	constexpr uint32_t comboCount = PIPELINE_COUNT * MATERIAL_COUNT * MESH_COUNT;
+
+	const std::vector<TestDrawItem> items = MakeOpaqueItems(itemCount);
+	RenderQueue queue;
+	std::vector<TestBatch> batches;
+	BuildBatches(items, queue, batches);
+	CHECK_EQ(batches.size(), size_t(comboCount));
+
+	SubmissionFixture fixture(itemCount);
+	fixture.CommandList->Reset();
+	uint32_t issued = 0;
+	const uint32_t elided = fixture.Record(batches, &issued);
+	fixture.CommandList->Close();
+
+	const NullRHICommandStats& stats = fixture.GetNullCommandList().GetStats();
+	CHECK_EQ(stats.GetDrawCount(), uint64_t(comboCount));
+	CHECK_EQ(stats.Instances, uint64_t(itemCount));
+	CHECK_EQ(stats.Primitives, uint64_t(itemCount) * (MESH_INDEX_COUNT / 3));
+
+	CHECK_EQ(stats.GetCount(NullRHICommandType::SetPipeline), uint64_t(PIPELINE_COUNT));
+	CHECK_EQ(stats.GetCount(NullRHICommandType::SetVertexBuffer), uint64_t(1));
+	CHECK_EQ(stats.GetCount(NullRHICommandType::SetIndexBuffer), uint64_t(1));
+	CHECK_EQ(stats.GetCount(NullRHICommandType::SetPrimitiveTopology), uint64_t(1));
+	CHECK_EQ(stats.GetCount(NullRHICommandType::SetShaderResource), uint64_t(comboCount));
+
+	// 묶음마다 상태 설정 4번 중 바뀐 것만 나갑니다.
+	CHECK_EQ(issued, PIPELINE_COUNT + 3);
+	CHECK_EQ(elided, comboCount * 4 - issued);
+
+	// 제출하면 큐 통계에 그대로 합산됩니다.
+	NullRHICommandQueue& queueRHI = static_cast<NullRHICommandQueue&>(*fixture.Device.GetQueue(RHIQueueType::Direct));
+	RHICommandList* commandList = fixture.CommandList.get();
+	queueRHI.Submit(&commandList, 1);
+	CHECK_EQ(queueRHI.GetSubmitCount(), uint64_t(1));
+	CHECK_EQ(queueRHI.GetSubmittedStats().GetDrawCount(), uint64_t(comboCount));
+}
+
+// 같은 묶음 안의 불투명 인스턴스는 앞에서 뒤로 놓이고, 같은 상태가 두 묶음으로 갈라지지 않아야 합니다.
+ENGINE_TEST(SubmissionOpaqueBatchOrder)
+{
+	const std::vector<TestDrawItem> items = MakeOpaqueItems(3000);
+	RenderQueue queue;
+	std::vector<TestBatch> batches;
+	BuildBatches(items, queue, batches);
+
+	const std::vector<RenderPacket>& packets = queue.GetPackets();
+	for (size_t b = 0; b < batches.size(); ++b)
+	{
+		if (b > 0) CHECK(batches[b - 1].StateBits < batches[b].StateBits);
+
+		const TestBatch& batch = batches[b];
+		for (uint32_t i = batch.FirstInstance + 1; i < batch.FirstInstance + batch.InstanceCount; ++i)
+		{
+			CHECK(items[packets[i - 1].Index].Depth <= items[packets[i].Index].Depth);
+		}
+	}
+}
+
+// 반투명은 같은 패스의 불투명 뒤에 뒤에서 앞으로 그려지며, 깊이가 다르면 상태가 같아도 묶이지 않습니다.
+ENGINE_TEST(SubmissionTranslucentAfterOpaque)
+{
+	std::vector<TestDrawItem> items = MakeOpaqueItems(600);
+	constexpr uint32_t translucentCount = 5;
+	for (uint32_t i = 0; i < translucentCount; ++i)
+	{
+		TestDrawItem item;
+		item.Depth = 1.0f + static_cast<float>(i);
+		item.Translucent = true;
+		items.push_back(item);
+	}
+
+	RenderQueue queue;
+	std::vector<TestBatch> batches;
+	BuildBatches(items, queue, batches);
+	CHECK_EQ(batches.size(), size_t(PIPELINE_COUNT * MATERIAL_COUNT * MESH_COUNT + translucentCount));
+
+	const std::vector<RenderPacket>& packets = queue.GetPackets();
+	const size_t firstTranslucent = packets.size() - translucentCount;
+	for (size_t i = 0; i < packets.size(); ++i)
+	{
+		CHECK_EQ(RenderSortKey::IsTranslucent(packets[i].Key), i >= firstTranslucent);
+	}
+	for (size_t i = firstTranslucent + 1; i < packets.size(); ++i)
+	{
+		CHECK(items[packets[i - 1].Index].Depth > items[packets[i].Index].Depth);
+	}
+
+	SubmissionFixture fixture(items.size());
+	fixture.CommandList->Reset();
+	fixture.Record(batches);
+	fixture.CommandList->Close();
+	CHECK_EQ(fixture.GetNullCommandList().GetStats().GetDrawCount(), uint64_t(batches.size()));
+}
+
+// 렌더 큐 정렬 벤치마크 (LSD 기수 정렬 vs std::stable_sort)
+ENGINE_BENCHMARK(RenderQueueSort)
+{
+	const size_t counts[] = { 1000, 10000, 100000 };
+	for (size_t count : counts)
+	{
+		const RenderQueue::BenchmarkResult result = RenderQueue::RunBenchmark(count, 50);
+		std::printf("  [RenderQueue] Count: %zu, Radix: %.4fms, StableSort: %.4fms, Matches: %s\n",
+			result.Count, result.RadixMs, result.StdSortMs, result.Matches ? "true" : "false");
+	}
+}
+
+// 드로우 제출 비용 벤치마크 (NullRHI: GPU 없이 정렬 + 묶음 + 인스턴스 복사 + 명령 기록만)
+ENGINE_BENCHMARK(RenderSubmission)
+{
+	constexpr uint32_t itemCount = 10000;
+	constexpr int iterations = 50;
+
+	const std::vector<TestDrawItem> items = MakeOpaqueItems(itemCount);
+	const std::vector<float> instanceData(itemCount * 16, 1.0f);
+
+	SubmissionFixture fixture(itemCount);
+	RenderQueue queue;
+	std::vector<TestBatch> batches;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i)
+	{
+		BuildBatches(items, queue, batches);
+		std::memcpy(fixture.InstanceBuffer->Map(), instanceData.data(), instanceData.size() * sizeof(float));
+
+		fixture.CommandList->Reset();
+		fixture.Record(batches);
+		fixture.CommandList->Close();
+	}
+	const double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	const NullRHICommandStats& stats = fixture.GetNullCommandList().GetStats();
+	std::printf("  [RHI Submit] Items: %u, Draws: %llu, Instances: %llu, Commands: %llu, Record: %.4fms\n",
+		itemCount, static_cast<unsigned long long>(stats.GetDrawCount()), static_cast<unsigned long long>(stats.Instances),
+		static_cast<unsigned long long>(stats.GetTotalCommands()), totalMs / iterations);
+}
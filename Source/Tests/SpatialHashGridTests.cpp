@@ -0,0 +1,190 @@
+// SpatialHashGridTests.cpp
+// SpatialHashGrid의 재구성(카운팅 정렬)과 반지름/k-최근접 질의를 전수 검사 결과와 비교합니다.
+#include "TestFramework.h"
+
+#include "Core/JobSystem.h"
+#include "Spatial/SpatialHashGrid.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <random>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr float CELL_SIZE = 2.0f;
+
+	// 고정 시드라서 실행할 때마다 같은 배치가 나옵니다. 음수 셀 좌표도 섞이도록 원점 주위에 뿌립니다.
+	std::vector<XMFLOAT3> MakePositions(size_t count, uint32_t seed, float extent = 50.0f)
+	{
+		std::mt19937 random(seed);
+		std::uniform_real_distribution<float> coordinate(-extent, extent);
+
+		std::vector<XMFLOAT3> positions(count);
+		for (XMFLOAT3& p : positions)
+		{
+			p = XMFLOAT3(coordinate(random), coordinate(random), coordinate(random));
+		}
+		return positions;
+	}
+
+	// 격자와 같은 식으로 계산해야 경계에 걸친 점의 판정이 같아집니다.
+	float DistanceSq(const XMFLOAT3& p, const XMFLOAT3& center)
+	{
+		const float dx = p.x - center.x, dy = p.y - center.y, dz = p.z - center.z;
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	std::vector<uint32_t> BruteForceRadius(const std::vector<XMFLOAT3>& positions, const XMFLOAT3& center, float radius)
+	{
+		std::vector<uint32_t> result;
+		for (uint32_t i = 0; i < positions.size(); ++i)
+		{
+			if (DistanceSq(positions[i], center) <= radius * radius) result.push_back(i);
+		}
+		return result;
+	}
+
+	std::vector<uint32_t> BruteForceKNearest(const std::vector<XMFLOAT3>& positions, const XMFLOAT3& center, size_t k, float maxRadius)
+	{
+		std::vector<std::pair<float, uint32_t>> candidates;
+		for (uint32_t i = 0; i < positions.size(); ++i)
+		{
+			const float distSq = DistanceSq(positions[i], center);
+			if (distSq <= maxRadius * maxRadius) candidates.emplace_back(distSq, i);
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		std::vector<uint32_t> result;
+		for (size_t i = 0; i < (std::min)(k, candidates.size()); ++i)
+		{
+			result.push_back(candidates[i].second);
+		}
+		return result;
+	}
+
+	std::vector<uint32_t> Sorted(std::span<const uint32_t> indices)
+	{
+		std::vector<uint32_t> result(indices.begin(), indices.end());
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+}
+
+// 재구성 결과는 모든 인덱스를 한 번씩 담고, 각 엔티티는 자기 셀의 구간 안에 있어야 합니다.
+// 병렬 재구성은 청크 순서대로 분배하므로 단일 스레드 결과와 똑같아야 합니다.
+ENGINE_TEST(SpatialGridRebuild)
+{
+	const std::vector<XMFLOAT3> positions = MakePositions(5000, 1);
+
+	SpatialHashGrid grid(CELL_SIZE);
+	grid.Build(positions.data(), positions.size());
+
+	CHECK_EQ(grid.GetCount(), positions.size());
+	CHECK(grid.GetBucketCount() >= positions.size());
+
+	std::vector<uint32_t> all = Sorted(grid.GetSortedIndices());
+	bool isPermutation = true;
+	for (uint32_t i = 0; i < all.size(); ++i) isPermutation &= (all[i] == i);
+	CHECK(isPermutation);
+
+	bool inOwnCell = true;
+	for (uint32_t i = 0; i < positions.size(); ++i)
+	{
+		const std::span<const uint32_t> cell = grid.GetCellSpan(positions[i]);
+		inOwnCell &= (std::find(cell.begin(), cell.end(), i) != cell.end());
+	}
+	CHECK(inOwnCell);
+
+	JobSystem jobs(3);
+	SpatialHashGrid parallelGrid(CELL_SIZE);
+	parallelGrid.Build(positions.data(), positions.size(), &jobs);
+	CHECK(std::equal(grid.GetSortedIndices().begin(), grid.GetSortedIndices().end(),
+		parallelGrid.GetSortedIndices().begin(), parallelGrid.GetSortedIndices().end()));
+
+	// 같은 격자를 더 적은 엔티티로 다시 만들면 이전 내용이 남지 않아야 합니다.
+	const std::vector<XMFLOAT3> moved = MakePositions(100, 2);
+	grid.Build(moved.data(), moved.size(), &jobs);
+	CHECK_EQ(grid.GetCount(), moved.size());
+	all = Sorted(grid.GetSortedIndices());
+	CHECK_EQ(all.back(), uint32_t(moved.size() - 1));
+
+	grid.Build(nullptr, 0);
+	CHECK_EQ(grid.GetCount(), size_t(0));
+	CHECK(grid.GetCellSpan(XMFLOAT3(0.0f, 0.0f, 0.0f)).empty());
+}
+
+// 반지름 질의는 전수 검사와 같은 집합을 돌려주고, 결과 버퍼 뒤에 덧붙여야 합니다.
+ENGINE_TEST(SpatialGridQueryRadius)
+{
+	const std::vector<XMFLOAT3> positions = MakePositions(4000, 3);
+	const std::vector<XMFLOAT3> centers = MakePositions(32, 4, 60.0f);
+
+	JobSystem jobs(3);
+	SpatialHashGrid grid(CELL_SIZE);
+	grid.Build(positions.data(), positions.size(), &jobs);
+
+	std::vector<uint32_t> out;
+	SpatialHashGrid::QueryScratch scratch;
+
+	// 셀보다 작은 반지름, 여러 셀에 걸친 반지름, 버킷 수보다 많은 셀을 덮는 반지름(전체 훑기)
+	for (float radius : { 0.5f, CELL_SIZE, 7.5f, 40.0f, FLT_MAX })
+	{
+		bool matches = true;
+		for (const XMFLOAT3& center : centers)
+		{
+			out.clear();
+			const std::span<const uint32_t> result = grid.QueryRadius(center, radius, out, scratch);
+			matches &= (Sorted(result) == BruteForceRadius(positions, center, radius));
+		}
+		CHECK(matches);
+	}
+
+	// 이미 들어 있는 결과는 건드리지 않고, 돌려준 구간은 새로 덧붙인 부분만 가리킵니다.
+	out.assign(3, UINT32_MAX);
+	const std::span<const uint32_t> appended = grid.QueryRadius(centers[0], 10.0f, out, scratch);
+	CHECK_EQ(appended.data(), out.data() + 3);
+	CHECK_EQ(appended.size(), out.size() - 3);
+	CHECK_EQ(out[0], UINT32_MAX);
+	CHECK(Sorted(appended) == BruteForceRadius(positions, centers[0], 10.0f));
+}
+
+// k-최근접은 전수 검사를 (거리, 인덱스)로 정렬한 앞쪽 k개와 순서까지 같아야 합니다.
+ENGINE_TEST(SpatialGridQueryKNearest)
+{
+	const std::vector<XMFLOAT3> positions = MakePositions(4000, 5);
+	const std::vector<XMFLOAT3> centers = MakePositions(32, 6, 60.0f);
+
+	SpatialHashGrid grid(CELL_SIZE);
+	grid.Build(positions.data(), positions.size());
+
+	std::vector<uint32_t> out;
+	SpatialHashGrid::QueryScratch scratch;
+
+	for (size_t k : { size_t(1), size_t(8), size_t(64) })
+	{
+		for (float maxRadius : { 3.0f, 25.0f, 1000.0f })
+		{
+			bool matches = true;
+			for (const XMFLOAT3& center : centers)
+			{
+				const std::span<const uint32_t> result = grid.QueryKNearest(center, k, maxRadius, out, scratch);
+				const std::vector<uint32_t> expected = BruteForceKNearest(positions, center, k, maxRadius);
+				matches &= std::equal(result.begin(), result.end(), expected.begin(), expected.end());
+			}
+			CHECK(matches);
+		}
+	}
+
+	// 엔티티 수보다 많이 요청하면 전부를 가까운 순서로 돌려줍니다.
+	const std::vector<XMFLOAT3> few = MakePositions(10, 7);
+	grid.Build(few.data(), few.size());
+	const XMFLOAT3 origin(0.0f, 0.0f, 0.0f);
+	const std::span<const uint32_t> everyone = grid.QueryKNearest(origin, 100, FLT_MAX, out, scratch);
+	CHECK_EQ(everyone.size(), few.size());
+	CHECK(std::vector<uint32_t>(everyone.begin(), everyone.end()) == BruteForceKNearest(few, origin, 100, FLT_MAX));
+
+	CHECK(grid.QueryKNearest(origin, 0, FLT_MAX, out, scratch).empty());
+	CHECK(out.empty());
+}
@@ -0,0 +1,54 @@
+// TestFramework.h
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/*
+ * [TestFramework]
+ * 엔진의 CPU 전용 모듈(NullRHI, RenderQueue, 할당자 등)을 GPU/창 없이 검사하는 최소한의 테스트 러너입니다.
+ * - ENGINE_TEST(Name) { ... } 로 정의하면 정적 초기화 때 목록에 등록되고, TestMain이 순서대로 실행합니다.
+ * - ENGINE_BENCHMARK(Name)은 --benchmark 인자를 줬을 때만 실행합니다. (시간을 재서 출력만 하고 검사는 하지 않음)
+ * - CHECK 계열은 실패해도 멈추지 않고 기록만 하므로, 한 번 실행으로 실패한 검사를 모두 볼 수 있습니다.
+ */
+namespace TestFramework
+{
+	using TestFunc = void (*)();
+
+	struct TestCase
+	{
+		const char* Name = nullptr;
+		TestFunc Func = nullptr;
+		bool IsBenchmark = false;
+	};
+
+	std::vector<TestCase>& GetTestCases();
+
+	// 지금 실행 중인 테스트의 실패를 하나 기록합니다.
+	void ReportFailure(const char* file, int line, const char* expression);
+
+	struct Registrar
+	{
+		Registrar(const char* name, TestFunc func, bool isBenchmark)
+		{
+			GetTestCases().push_back({ name, func, isBenchmark });
+		}
+	};
+}
+
+#define ENGINE_TEST(name) \
+	static void name(); \
+	static TestFramework::Registrar name##Registrar(#name, &name, false); \
+	static void name()
+
+#define ENGINE_BENCHMARK(name) \
+	static void name(); \
+	static TestFramework::Registrar name##Registrar(#name, &name, true); \
+	static void name()
+
+#define CHECK(expression) \
+	do { if (!(expression)) TestFramework::ReportFailure(__FILE__, __LINE__, #expression); } while (false)
+
+#define CHECK_EQ(actual, expected) \
+	do { if (!((actual) == (expected))) TestFramework::ReportFailure(__FILE__, __LINE__, #actual " == " #expected); } while (false)
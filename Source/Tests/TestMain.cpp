@@ -0,0 +1,52 @@
+// TestMain.cpp
+#include "TestFramework.h"
+
+#include <cstring>
+
+namespace
+{
+	const char* g_currentTest = nullptr;
+	uint32_t g_currentFailures = 0;
+}
+
+std::vector<TestFramework::TestCase>& TestFramework::GetTestCases()
+{
+	// 정적 초기화 순서와 상관없이 쓸 수 있도록 함수 안의 정적 변수로 둡니다.
+	static std::vector<TestCase> testCases;
+	return testCases;
+}
+
+void TestFramework::ReportFailure(const char* file, int line, const char* expression)
+{
+	++g_currentFailures;
+	std::printf("  %s(%d): CHECK(%s) failed in %s\n", file, line, expression, g_currentTest);
+}
+
+// EngineTests.exe [--benchmark]
+// 실패한 테스트 수를 종료 코드로 돌려주므로 빌드 후 단계나 CI에서 그대로 쓸 수 있습니다.
+int main(int argc, char** argv)
+{
+	bool runBenchmarks = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--benchmark") == 0) runBenchmarks = true;
+	}
+
+	int failedTests = 0;
+	int runTests = 0;
+	for (const TestFramework::TestCase& testCase : TestFramework::GetTestCases())
+	{
+		if (testCase.IsBenchmark && !runBenchmarks) continue;
+
+		g_currentTest = testCase.Name;
+		g_currentFailures = 0;
+		testCase.Func();
+
+		++runTests;
+		if (g_currentFailures > 0) ++failedTests;
+		std::printf("[%s] %s\n", (g_currentFailures > 0) ? "FAIL" : "PASS", testCase.Name);
+	}
+
+	std::printf("%d / %d passed\n", runTests - failedTests, runTests);
+	return failedTests;
+}
@@ -0,0 +1,153 @@
+// TlsfAllocatorTests.cpp
+// TlsfAllocator의 분할, 해제 시 병합, 정렬 패딩, 공간 부족을 검사합니다.
+#include "TestFramework.h"
+
+#include "Utils/TlsfAllocator.h"
+
+namespace
+{
+	constexpr uint64_t GRANULARITY = 256;
+}
+
+// 빈 블록에서 요청 크기(granularity 올림)만 잘라 쓰고 나머지는 빈 블록 하나로 남아야 합니다.
+ENGINE_TEST(TlsfSplitOnAllocate)
+{
+	constexpr uint64_t capacity = 64 * 1024;
+	TlsfAllocator allocator(capacity, GRANULARITY);
+
+	const TlsfAllocator::Allocation first = allocator.Allocate(1000);
+	CHECK(first.IsValid());
+	CHECK_EQ(first.Offset, uint64_t(0));
+	CHECK_EQ(first.Size, uint64_t(1024));
+
+	const TlsfAllocator::Allocation second = allocator.Allocate(300);
+	CHECK(second.IsValid());
+	CHECK_EQ(second.Offset, uint64_t(1024));
+	CHECK_EQ(second.Size, uint64_t(512));
+
+	const TlsfAllocator::Stats stats = allocator.GetStats();
+	CHECK_EQ(stats.AllocationCount, 2u);
+	CHECK_EQ(stats.UsedBytes, uint64_t(1536));
+	CHECK_EQ(stats.FreeBlockCount, 1u);
+	CHECK_EQ(stats.LargestFreeBlock, capacity - 1536);
+	CHECK_EQ(stats.UsedBytes + stats.FreeBytes, capacity);
+}
+
+// 해제한 블록은 물리적으로 이웃한 빈 블록과 바로 합쳐져서, 모두 해제하면 처음의 한 덩어리로 돌아가야 합니다.
+ENGINE_TEST(TlsfMergeOnFree)
+{
+	constexpr uint64_t capacity = 16 * 1024;
+	TlsfAllocator allocator(capacity, GRANULARITY);
+
+	const TlsfAllocator::Allocation a = allocator.Allocate(1024);
+	const TlsfAllocator::Allocation b = allocator.Allocate(2048);
+	const TlsfAllocator::Allocation c = allocator.Allocate(1024);
+	CHECK(a.IsValid() && b.IsValid() && c.IsValid());
+
+	// 가운데를 풀면 양옆이 사용 중이므로 구멍 하나 + 뒤쪽 남는 공간
+	allocator.Free(b);
+	CHECK_EQ(allocator.GetStats().FreeBlockCount, 2u);
+
+	// 같은 크기는 그 구멍을 다시 씁니다.
+	const TlsfAllocator::Allocation reused = allocator.Allocate(2048);
+	CHECK_EQ(reused.Offset, b.Offset);
+	allocator.Free(reused);
+
+	// 앞을 풀면 구멍과 합쳐져 빈 블록 수는 그대로이고, 가장 큰 빈 블록은 뒤쪽 남는 공간입니다.
+	allocator.Free(a);
+	TlsfAllocator::Stats stats = allocator.GetStats();
+	CHECK_EQ(stats.FreeBlockCount, 2u);
+	CHECK_EQ(stats.LargestFreeBlock, capacity - 4096);
+
+	// 합쳐진 앞쪽 구멍(a + b)에 한 번에 들어가야 합니다.
+	const TlsfAllocator::Allocation merged = allocator.Allocate(3072);
+	CHECK_EQ(merged.Offset, uint64_t(0));
+	allocator.Free(merged);
+
+	// 마지막을 풀면 앞뒤 모두와 합쳐져 한 덩어리
+	allocator.Free(c);
+	stats = allocator.GetStats();
+	CHECK(allocator.IsEmpty());
+	CHECK_EQ(stats.FreeBlockCount, 1u);
+	CHECK_EQ(stats.LargestFreeBlock, capacity);
+	CHECK_EQ(stats.GetFragmentation(), 0.0f);
+}
+
+// 정렬 때문에 생긴 앞쪽 패딩은 빈 블록으로 남아 다른 할당이 쓸 수 있어야 합니다.
+ENGINE_TEST(TlsfAlignmentPadding)
+{
+	constexpr uint64_t capacity = 64 * 1024;
+	TlsfAllocator allocator(capacity, GRANULARITY);
+
+	const TlsfAllocator::Allocation small = allocator.Allocate(256);
+	CHECK_EQ(small.Offset, uint64_t(0));
+
+	const TlsfAllocator::Allocation aligned = allocator.Allocate(4096, 4096);
+	CHECK(aligned.IsValid());
+	CHECK_EQ(aligned.Offset, uint64_t(4096));
+	CHECK_EQ(aligned.Offset % 4096, uint64_t(0));
+
+	// [256, 4096) 패딩 + 뒤쪽 남는 공간
+	TlsfAllocator::Stats stats = allocator.GetStats();
+	CHECK_EQ(stats.FreeBlockCount, 2u);
+	CHECK_EQ(stats.UsedBytes, uint64_t(256 + 4096));
+
+	const TlsfAllocator::Allocation filler = allocator.Allocate(4096 - 256);
+	CHECK_EQ(filler.Offset, uint64_t(256));
+	CHECK_EQ(allocator.GetStats().FreeBlockCount, 1u);
+
+	// granularity보다 작은 정렬은 granularity로 올림합니다.
+	const TlsfAllocator::Allocation tiny = allocator.Allocate(1, 16);
+	CHECK_EQ(tiny.Offset % GRANULARITY, uint64_t(0));
+	CHECK_EQ(tiny.Size, GRANULARITY);
+}
+
+// 들어갈 곳이 없으면 예외 없이 무효 할당을 돌려주고, 상태는 바뀌지 않아야 합니다.
+ENGINE_TEST(TlsfOutOfSpace)
+{
+	constexpr uint64_t capacity = 8 * 1024;
+	TlsfAllocator allocator(capacity, GRANULARITY);
+
+	CHECK(!allocator.Allocate(capacity + 1).IsValid());
+
+	const TlsfAllocator::Allocation all = allocator.Allocate(capacity);
+	CHECK(all.IsValid());
+	CHECK(!allocator.Allocate(1).IsValid());
+	CHECK_EQ(allocator.GetAllocationCount(), 1u);
+	allocator.Free(all);
+
+	// granularity 단위로 꽉 채운 뒤 하나 건너 하나씩 풀면 빈 공간은 절반이지만 한 칸씩 흩어집니다.
+	std::vector<TlsfAllocator::Allocation> slots;
+	for (uint64_t i = 0; i < capacity / GRANULARITY; ++i)
+	{
+		slots.push_back(allocator.Allocate(GRANULARITY));
+		CHECK(slots.back().IsValid());
+	}
+	for (size_t i = 0; i < slots.size(); i += 2)
+	{
+		allocator.Free(slots[i]);
+	}
+
+	const TlsfAllocator::Stats stats = allocator.GetStats();
+	CHECK_EQ(stats.FreeBytes, capacity / 2);
+	CHECK_EQ(stats.LargestFreeBlock, GRANULARITY);
+	CHECK(stats.GetFragmentation() > 0.9f);
+	CHECK(!allocator.Allocate(2 * GRANULARITY).IsValid());
+	CHECK(allocator.Allocate(GRANULARITY).IsValid());
+}
+
+// 패딩을 가정한 검색 크기로는 못 찾아도, 이미 정렬된 빈 블록이면 딱 맞게 들어가야 합니다.
+ENGINE_TEST(TlsfAlignedExactFit)
+{
+	constexpr uint64_t capacity = 8 * 1024;
+	TlsfAllocator allocator(capacity, GRANULARITY);
+
+	const TlsfAllocator::Allocation front = allocator.Allocate(4096);
+	const TlsfAllocator::Allocation back = allocator.Allocate(4096);
+	CHECK(front.IsValid() && back.IsValid());
+	allocator.Free(back);
+
+	const TlsfAllocator::Allocation aligned = allocator.Allocate(4096, 4096);
+	CHECK(aligned.IsValid());
+	CHECK_EQ(aligned.Offset, uint64_t(4096));
+}
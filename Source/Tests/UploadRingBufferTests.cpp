@@ -0,0 +1,177 @@
+// UploadRingBufferTests.cpp
+// UploadRingBuffer의 head/tail/사용량 계산을 NullRHI 버퍼(실제 CPU 메모리) 위에서 검사합니다.
+// (가득 참과 비어 있음 구분, 되감기, 펜스 값에 따른 반납, 정렬 패딩)
+#include "TestFramework.h"
+
+#include "RHI/NullRHI.h"
+#include "RHI/UploadRingBuffer.h"
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+	constexpr uint64_t CAPACITY = 4096;
+	constexpr uint64_t ALIGNMENT = UploadRingBuffer::CONSTANT_BUFFER_ALIGNMENT;
+
+	bool AllocateThrows(UploadRingBuffer& ring, uint64_t size)
+	{
+		try
+		{
+			ring.Allocate(size);
+		}
+		catch (const std::runtime_error&)
+		{
+			return true;
+		}
+		return false;
+	}
+}
+
+// 용량에 딱 맞게 채우면 head == tail이지만 가득 찬 상태여야 하고, 다음 할당은 거절돼야 합니다.
+// 그 프레임의 펜스가 지나가면 통째로 비고 0번부터 다시 씁니다.
+ENGINE_TEST(UploadRingExactFill)
+{
+	NullRHIDevice device;
+	UploadRingBuffer ring(device, CAPACITY);
+	CHECK_EQ(ring.GetCapacity(), CAPACITY);
+
+	for (uint64_t i = 0; i < CAPACITY / ALIGNMENT; ++i)
+	{
+		const UploadRingBuffer::Allocation allocation = ring.Allocate(ALIGNMENT);
+		CHECK_EQ(allocation.Offset, i * ALIGNMENT);
+	}
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY);
+	CHECK_EQ(ring.GetFrameBytes(), CAPACITY);
+
+	UploadRingBuffer::Allocation rejected;
+	CHECK(!ring.TryAllocate(1, ALIGNMENT, rejected));
+	CHECK(AllocateThrows(ring, 1));
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY);
+
+	// 아직 펜스 1을 지나지 않았으면 그대로 가득 차 있습니다.
+	ring.EndFrame(1);
+	ring.BeginFrame(0);
+	CHECK_EQ(ring.GetInFlightFrameCount(), size_t(1));
+	CHECK(!ring.TryAllocate(1, ALIGNMENT, rejected));
+
+	ring.BeginFrame(1);
+	CHECK_EQ(ring.GetInFlightFrameCount(), size_t(0));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(0));
+	CHECK_EQ(ring.Allocate(ALIGNMENT).Offset, uint64_t(0));
+}
+
+// 끝에 자리가 없으면 0번으로 되감는데, 앞쪽은 가장 오래된 프레임이 반납된 뒤에야 쓸 수 있습니다.
+// 되감으면서 버린 끝부분은 되감은 프레임이 떠안았다가 그 프레임이 반납될 때 함께 돌아옵니다.
+ENGINE_TEST(UploadRingWrapAfterRetire)
+{
+	NullRHIDevice device;
+	UploadRingBuffer ring(device, CAPACITY);
+
+	// 프레임 1: [0, 2048)
+	ring.Allocate(1024);
+	ring.Allocate(1024);
+	ring.EndFrame(1);
+
+	// 프레임 2: [2048, 3584)
+	ring.BeginFrame(0);
+	CHECK_EQ(ring.Allocate(1536).Offset, uint64_t(2048));
+	ring.EndFrame(2);
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(3584));
+
+	// 프레임 3: 끝에는 512바이트뿐이고 앞쪽은 프레임 1이 아직 쓰고 있습니다.
+	UploadRingBuffer::Allocation allocation;
+	ring.BeginFrame(0);
+	CHECK(!ring.TryAllocate(1024, ALIGNMENT, allocation));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(3584));
+
+	// 프레임 1이 끝나면 [0, 2048)이 비므로 되감아서 들어갑니다.
+	ring.BeginFrame(1);
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(1536));
+	CHECK(ring.TryAllocate(1024, ALIGNMENT, allocation));
+	CHECK_EQ(allocation.Offset, uint64_t(0));
+	CHECK_EQ(ring.GetFrameBytes(), uint64_t(512 + 1024)); // 버린 [3584, 4096) 포함
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(1536 + 512 + 1024));
+
+	// 되감긴 상태에서는 [head, tail) = [1024, 2048)만 쓸 수 있고, 딱 채우면 가득 찬 상태입니다.
+	CHECK(ring.TryAllocate(1024, ALIGNMENT, allocation));
+	CHECK_EQ(allocation.Offset, uint64_t(1024));
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY);
+	CHECK(!ring.TryAllocate(ALIGNMENT, ALIGNMENT, allocation));
+	ring.EndFrame(3);
+
+	// 프레임 4: 프레임 2를 반납하면 꼬리가 3584로 가서 [2048, 3584)를 쓸 수 있습니다.
+	// 끝의 버린 512바이트는 여전히 프레임 3 몫이므로 다시 딱 채우면 가득 찹니다.
+	ring.BeginFrame(2);
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY - 1536);
+	CHECK(ring.TryAllocate(1536, ALIGNMENT, allocation));
+	CHECK_EQ(allocation.Offset, uint64_t(2048));
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY);
+	CHECK(!ring.TryAllocate(ALIGNMENT, ALIGNMENT, allocation));
+	ring.EndFrame(4);
+
+	// 펜스 순서대로 반납되고, 모두 반납되면 0번부터 다시 시작합니다.
+	ring.BeginFrame(3);
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(1536));
+	ring.BeginFrame(4);
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(0));
+	CHECK_EQ(ring.GetInFlightFrameCount(), size_t(0));
+	CHECK_EQ(ring.Allocate(CAPACITY).Offset, uint64_t(0));
+}
+
+// 정렬 때문에 건너뛴 바이트도 사용량에 들어가야 반납할 때 정확히 0으로 돌아옵니다.
+ENGINE_TEST(UploadRingAlignmentPadding)
+{
+	NullRHIDevice device;
+	UploadRingBuffer ring(device, CAPACITY);
+
+	const UploadRingBuffer::Allocation first = ring.Allocate(100);
+	CHECK_EQ(first.Offset, uint64_t(0));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(100));
+
+	// [100, 256) 패딩 + 64
+	const UploadRingBuffer::Allocation second = ring.Allocate(64);
+	CHECK_EQ(second.Offset, uint64_t(256));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(256 + 64));
+
+	// 더 큰 정렬: [320, 512) 패딩 + 8
+	UploadRingBuffer::Allocation third;
+	CHECK(ring.TryAllocate(8, 512, third));
+	CHECK_EQ(third.Offset, uint64_t(512));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(512 + 8));
+	CHECK_EQ(ring.GetFrameBytes(), ring.GetUsedBytes());
+
+	// 주소는 버퍼 시작 기준의 같은 오프셋이고, CPU 주소는 실제로 쓸 수 있어야 합니다.
+	CHECK_EQ(third.GPUAddress - first.GPUAddress, third.Offset);
+	CHECK_EQ(static_cast<uint8_t*>(third.CPUAddress) - static_cast<uint8_t*>(first.CPUAddress), static_cast<ptrdiff_t>(third.Offset));
+	const uint32_t value = 0xDEADBEEF;
+	const uint64_t address = ring.PushConstants(value);
+	CHECK_EQ(address - first.GPUAddress, uint64_t(768));
+	uint32_t written = 0;
+	std::memcpy(&written, static_cast<uint8_t*>(first.CPUAddress) + 768, sizeof(written));
+	CHECK_EQ(written, value);
+
+	ring.EndFrame(1);
+	ring.BeginFrame(1);
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(0));
+}
+
+// 버퍼보다 큰 요청은 기다려도 들어갈 수 없으므로 Allocate는 던지고, TryAllocate는 상태를 건드리지 않고 실패합니다.
+ENGINE_TEST(UploadRingOversizedAllocation)
+{
+	NullRHIDevice device;
+	UploadRingBuffer ring(device, CAPACITY - 100); // 256 단위로 올림
+	CHECK_EQ(ring.GetCapacity(), CAPACITY);
+
+	CHECK(AllocateThrows(ring, CAPACITY + 1));
+
+	UploadRingBuffer::Allocation allocation;
+	CHECK(!ring.TryAllocate(CAPACITY + 1, ALIGNMENT, allocation));
+	CHECK_EQ(ring.GetUsedBytes(), uint64_t(0));
+	CHECK_EQ(ring.GetFrameBytes(), uint64_t(0));
+
+	// 버퍼 크기와 같은 요청은 비어 있을 때 들어갑니다.
+	CHECK(!AllocateThrows(ring, CAPACITY));
+	CHECK_EQ(ring.GetUsedBytes(), CAPACITY);
+}